@@ -0,0 +1,23 @@
+#pragma once                                                    // include guard
+
+#include <cstddef>                                              // size_t
+#include <functional>                                           // hash
+#include <string>
+
+#include "Book.hpp"
+
+
+// Hashes a Book's identity:  its ISBN, title, and author.  The price is intentionally left out since Book::operator== treats
+// prices within epsilon of each other as equal, and books that compare equal must hash the same.
+struct BookHash
+{
+  std::size_t operator()( Book const & book ) const noexcept
+  {
+    std::hash<std::string> hash;
+
+    std::size_t seed = hash( book.isbn() );
+    seed ^= hash( book.title()  ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+    seed ^= hash( book.author() ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+    return seed;
+  }
+};
@@ -1,4 +1,4 @@
-#include <algorithm>                              // find(), move(), move_backward(), equal(), swap(), lexicographical_compare()
+#include <algorithm>                              // find(), move(), move_backward(), copy(), equal(), mismatch(), rotate()
 #include <cmath>                                  // min()
 #include <cstddef>                                // size_t
 #include <initializer_list>
@@ -6,6 +6,7 @@
 #include <iterator>                               // distance(), next()
 #include <stdexcept>                              // logic_error
 #include <string>
+#include <unordered_set>
 
 #include "Book.hpp"
 #include "BookList.hpp"
@@ -38,12 +39,13 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Initializer List Constructor
-BookList::BookList( const std::initializer_list<Book> & initList )
+template<class ConsistencyCheck>
+BookListType<ConsistencyCheck>::BookListType( const std::initializer_list<Book> & initList )
 {
-  for( auto && book : initList )   insert( book, Position::BOTTOM );
+  append_range( initList );
 
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyMutation();
 }
 
 
@@ -63,17 +65,18 @@ BookList::BookList( const std::initializer_list<Book> & initList )
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // size() const
-std::size_t BookList::size() const
+template<class ConsistencyCheck>
+std::size_t BookListType<ConsistencyCheck>::size() const
 {
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyQuery();
 
   ///////////////////////// TO-DO (1) //////////////////////////////
     /// All the containers are the same size, so pick one and return the size of that.  Since the forward_list has to calculate the
     /// size on demand, stay away from using that one.
 
   // Obvious O(1) without relying on std::vector.
-  return _books_array_size;
+  return _books_array.size();
   /////////////////////// END-TO-DO (1) ////////////////////////////
 }
 
@@ -94,10 +97,11 @@ std::size_t BookList::size() const
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // find() const
-std::size_t BookList::find( const Book & book ) const
+template<class ConsistencyCheck>
+std::size_t BookListType<ConsistencyCheck>::find( const Book & book ) const
 {
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyQuery();
 
   ///////////////////////// TO-DO (2) //////////////////////////////
     /// Locate the book in this book list and return the zero-based position of that book.  If the book does not exist, return the
@@ -105,10 +109,16 @@ std::size_t BookList::find( const Book & book ) const
     /// (array, vector, list, and forward_list) so pick just one of those to search.  The STL provides the find() function that is a
     /// perfect fit here, but you may also write your own loop.
 
-  // Iterating over std::vectors is probably the fastest here without relying
-  // on the array for CPU cache line reasons.
-  auto pos = std::find(_books_vector.begin(), _books_vector.end(), book);
-  return std::distance(_books_vector.begin(), pos);
+  // Short lists: iterating over std::vectors is probably the fastest here
+  // without relying on the array for CPU cache line reasons.
+  if (_books_array.size() < INDEX_THRESHOLD) {
+    auto pos = std::find(_books_vector.begin(), _books_vector.end(), book);
+    return std::distance(_books_vector.begin(), pos);
+  }
+
+  // Long lists: a linear scan makes building a list of n books O(n^2), so go
+  // through the hash side-index instead.
+  return indexed_find(book);
   /////////////////////// END-TO-DO (2) ////////////////////////////
 }
 
@@ -129,7 +139,8 @@ std::size_t BookList::find( const Book & book ) const
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // insert( position )
-void BookList::insert( const Book & book, Position position )
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::insert( const Book & book, Position position )
 {
   // Convert the TOP and BOTTOM enumerations to an offset and delegate the work
   if     ( position == Position::TOP    )  insert( book, 0      );
@@ -140,12 +151,14 @@ void BookList::insert( const Book & book, Position position )
 
 
 // insert( offset )
-void BookList::insert( const Book & book, std::size_t offsetFromTop )       // insert new book at offsetFromTop, which places it before the current book at offsetFromTop
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::insert( const Book & book, std::size_t offsetFromTop )       // insert new book at offsetFromTop, which places it before the current book at offsetFromTop
 {
   // Validate offset parameter before attempting the insertion.  std::size_t is an unsigned type, so no need to check for negative
   // offsets, and an offset equal to the size of the list says to insert at the end (bottom) of the list.  Anything greater than the
   // current size is an error.
   if( offsetFromTop > size() )   throw InvalidOffset_Ex( "Insertion position beyond end of current list size" exception_location );
+  const bool atBottom = offsetFromTop == _books_array.size();
 
 
   /**********  Prevent duplicate entries  ***********************/
@@ -184,22 +197,27 @@ void BookList::insert( const Book & book, std::size_t offsetFromTop )       // i
 
     // BE CAREFUL HERE! Don't rely on size(), because what size() returns within
     // insert/remove may be inconsistent depending on what I decide to return.
-    // It is therefore best to rely on _books_array_size directly.
+    // It is therefore best to rely on _books_array.size() directly.
+    const auto count = _books_array.size();
+
+    // Capacity checking. The array grows onto the heap once it outgrows its
+    // inline books, so this only trips if we run out of address space.
+    if (count >= _books_array.max_size()) throw CapacityExceeded_Ex ("Array exceeded size" exception_location);
 
-    // Capacity checking.
-    if (_books_array_size >= _books_array.size()) throw CapacityExceeded_Ex ("Array exceeded size" exception_location);
+    // Grow first: it may move the books, so take the pointers afterwards.
+    _books_array.resize(count + 1);
 
     auto *i = _books_array.begin() + offsetFromTop;
-    auto *j = _books_array.begin() + _books_array_size;
+    auto *j = _books_array.begin() + count;
     // Per documentation, end is the END of the destination region. Since
     // we're shifting [i, j) forward one position, the end of said region
     // would be j+1.
-    auto *end = _books_array.begin() + _books_array_size + 1;
+    auto *end = _books_array.begin() + count + 1;
 
     std::move_backward(i, j, end);
 
-    _books_array_size++;
     _books_array.at(offsetFromTop) = book;
+    _consistency.added(ConsistencyPolicy::Container::ARRAY, book);
     /////////////////////// END-TO-DO (4) ////////////////////////////
   } // Part 1 - Insert into array
 
@@ -218,6 +236,7 @@ void BookList::insert( const Book & book, std::size_t offsetFromTop )       // i
       /// did for the array above.
 
     _books_vector.insert(_books_vector.begin() + offsetFromTop, book);
+    _consistency.added(ConsistencyPolicy::Container::VECTOR, book);
     /////////////////////// END-TO-DO (5) ////////////////////////////
   } // Part 2 - Insert into vector
 
@@ -232,7 +251,16 @@ void BookList::insert( const Book & book, std::size_t offsetFromTop )       // i
       /// STL has a function called std::next() that does that, or you can write your own loop.
  
     // Use std::next since + isn't defined for std::list's iterator.
-    _books_dl_list.insert(std::next(_books_dl_list.begin(), offsetFromTop), book);
+    auto node = _books_dl_list.insert(std::next(_books_dl_list.begin(), offsetFromTop), book);
+    _consistency.added(ConsistencyPolicy::Container::DL_LIST, *node);
+
+    // Keep the side-index in step. Appending at the bottom shifts nobody, so
+    // the index stays clean; anywhere else, everything after the new book
+    // has moved down one.
+    if (_books_index.engaged) {
+      _books_index.offsets.emplace(&*node, typename SideIndex::Entry{offsetFromTop, node});
+      if (!atBottom) _books_index.shifted(offsetFromTop);
+    }
     /////////////////////// END-TO-DO (6) ////////////////////////////
   } // Part 3 - Insert into doubly linked list
 
@@ -249,19 +277,118 @@ void BookList::insert( const Book & book, std::size_t offsetFromTop )       // i
 
     // Professor probably meant insert_after, not insert. Use std::next for
     // the same reason as above.
-    _books_sl_list.insert_after(std::next(_books_sl_list.before_begin(), offsetFromTop), book);
+    auto node = _books_sl_list.insert_after(std::next(_books_sl_list.before_begin(), offsetFromTop), book);
+    _consistency.added(ConsistencyPolicy::Container::SL_LIST, *node);
     /////////////////////// END-TO-DO (7) ////////////////////////////
   } // Part 4 - Insert into singly linked list
 
+  _books_digest += BookHash{}( book );
 
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyMutation();
 } // insert( const Book & book, std::size_t offsetFromTop )
 
 
 
+// insert_range( offset )
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::insert_range( std::size_t offsetFromTop, std::span<Book const> books )
+{
+  if( offsetFromTop > size() )   throw InvalidOffset_Ex( "Insertion position beyond end of current list size" exception_location );
+
+  const auto count    = _books_array.size();
+  const bool atBottom = offsetFromTop == count;
+
+  // Dedupe the whole batch with one hash set, seeded with the books already
+  // in the list, instead of a find() per book. This also drops duplicates
+  // within the batch itself.
+  std::unordered_set<Book const *, typename SideIndex::Hash, typename SideIndex::Equal> seen;
+  seen.reserve(count + books.size());
+  for (const auto & book : _books_vector) seen.insert(&book);
+
+  // The new books, in order, as a ready-made doubly linked segment. The
+  // other containers copy from it, and then it's spliced in whole.
+  std::list<Book> segment;
+  for (const auto & book : books) {
+    if (seen.insert(&book).second) segment.push_back(book);
+  }
+
+  const auto added = segment.size();
+  if (added == 0) return;
+  if (added > _books_array.max_size() - count) throw CapacityExceeded_Ex ("Array exceeded size" exception_location);
+
+  for (const auto & book : segment) _books_digest += BookHash{}(book);
+
+
+  { /**********  Part 1 - Insert into array  ***********************/
+    // Same shift as insert(), but by all the new books at once.
+    _books_array.resize(count + added);
+
+    auto *i = _books_array.begin() + offsetFromTop;
+    auto *j = _books_array.begin() + count;
+    std::move_backward(i, j, _books_array.begin() + count + added);
+    std::copy(segment.begin(), segment.end(), i);
+
+    for (const auto & book : segment) _consistency.added(ConsistencyPolicy::Container::ARRAY, book);
+  } // Part 1 - Insert into array
+
+
+  { /**********  Part 2 - Insert into vector  **********************/
+    // A bidirectional range lets vector size the gap, so this is one
+    // (possible) reallocation and one shift.
+    _books_vector.reserve(count + added);
+    _books_vector.insert(_books_vector.begin() + offsetFromTop, segment.begin(), segment.end());
+
+    for (const auto & book : segment) _consistency.added(ConsistencyPolicy::Container::VECTOR, book);
+  } // Part 2 - Insert into vector
+
+
+  { /**********  Part 4 - Insert into singly linked list  **********/
+    // Done before Part 3 since splicing empties the segment.
+    std::forward_list<Book> slSegment(segment.begin(), segment.end());
+    for (const auto & book : slSegment) _consistency.added(ConsistencyPolicy::Container::SL_LIST, book);
+
+    _books_sl_list.splice_after(std::next(_books_sl_list.before_begin(), offsetFromTop), slSegment);
+  } // Part 4 - Insert into singly linked list
+
+
+  { /**********  Part 3 - Insert into doubly linked list  **********/
+    for (const auto & book : segment) _consistency.added(ConsistencyPolicy::Container::DL_LIST, book);
+
+    // Splicing relinks the nodes rather than copying them, so first still
+    // points at the first new book afterwards.
+    auto first = segment.begin();
+    _books_dl_list.splice(std::next(_books_dl_list.begin(), offsetFromTop), segment);
+
+    // Keep the side-index in step, the same way insert() does.
+    if (_books_index.engaged) {
+      auto node = first;
+      for (auto offset = offsetFromTop; offset < offsetFromTop + added; ++offset, ++node) {
+        _books_index.offsets.emplace(&*node, typename SideIndex::Entry{offset, node});
+      }
+      if (!atBottom) _books_index.shifted(offsetFromTop);
+    }
+  } // Part 3 - Insert into doubly linked list
+
+
+  // Verify the internal book list state is still consistent amongst the four containers, once for the whole batch
+  verifyMutation();
+} // insert_range( std::size_t offsetFromTop, std::span<Book const> books )
+
+
+
+// append_range()
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::append_range( std::span<Book const> books )
+{
+  insert_range( _books_array.size(), books );
+}
+
+
+
 // remove( book )
-void BookList::remove( const Book & book )
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::remove( const Book & book )
 {
   // Delegate to the version of remove() that takes an index as a parameter
   remove( find( book ) );
@@ -270,7 +397,8 @@ void BookList::remove( const Book & book )
 
 
 // remove( offset )
-void BookList::remove( std::size_t offsetFromTop )
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::remove( std::size_t offsetFromTop )
 {
   // Removing from the book list means you remove the book from each of the containers (array, vector, list, and forward_list).
   // Because the data structure concept is different for each container, the way an book gets removed is a little different for
@@ -279,6 +407,8 @@ void BookList::remove( std::size_t offsetFromTop )
 
   if( offsetFromTop >= size() )   return;                                          // no change occurs if (zero-based) offsetFromTop >= size()
 
+  _books_digest -= BookHash{}( _books_vector[offsetFromTop] );
+
   
   { /**********  Part 1 - Remove from array  ***********************/
     ///////////////////////// TO-DO (8) //////////////////////////////
@@ -302,17 +432,18 @@ void BookList::remove( std::size_t offsetFromTop )
     //    = ...|z|b|c|d|*|...
     //
     auto *i = _books_array.begin() + offsetFromTop + 1;
-    auto *j = _books_array.begin() + _books_array_size;
+    auto *j = _books_array.end();
     // Move is similar to move_backward, except the third argument is the
     // START of the destination region. Shift all elements [i, j) backwards
     // once. 
     auto *start = _books_array.begin() + offsetFromTop;
 
+    _consistency.removed(ConsistencyPolicy::Container::ARRAY, *start);
     std::move(i, j, start);
 
     // The last index is invalid now (that's the * in the above diagram), so
-    // we decrement the size and hope nobody touches it.
-    _books_array_size--;
+    // drop it.
+    _books_array.resize(_books_array.size() - 1);
     /////////////////////// END-TO-DO (8) ////////////////////////////
   } // Part 1 - Remove from array
 
@@ -330,7 +461,9 @@ void BookList::remove( std::size_t offsetFromTop )
       /// Behind the scenes, std::vector::erase() shifts to the left everything after the insertion point, just like you did for the
       /// array above.
 
-    _books_vector.erase(_books_vector.begin() + offsetFromTop);
+    auto node = _books_vector.begin() + offsetFromTop;
+    _consistency.removed(ConsistencyPolicy::Container::VECTOR, *node);
+    _books_vector.erase(node);
     /////////////////////// END-TO-DO (9) ////////////////////////////
   } // Part 2 - Remove from vector
 
@@ -344,7 +477,16 @@ void BookList::remove( std::size_t offsetFromTop )
       /// offset from the top (the index) to an iterator by advancing _books_dl_list.begin() offsetFromTop times.  The STL has a function called
       /// std::next() that does that, or you can write your own loop.
 
-    _books_dl_list.erase(std::next(_books_dl_list.begin(), offsetFromTop));
+    auto node = std::next(_books_dl_list.begin(), offsetFromTop);
+
+    // Everything after the removed book moves up one.
+    if (_books_index.engaged) {
+      _books_index.offsets.erase(&*node);
+      if (offsetFromTop + 1 != _books_dl_list.size()) _books_index.shifted(offsetFromTop);
+    }
+
+    _consistency.removed(ConsistencyPolicy::Container::DL_LIST, *node);
+    _books_dl_list.erase(node);
     /////////////////////// END-TO-DO (10) ////////////////////////////
   } // Part 3 - Remove from doubly linked list
 
@@ -359,19 +501,22 @@ void BookList::remove( std::size_t offsetFromTop )
       /// advancing _books_sl_list.before_begin() offsetFromTop times.  The STL has a function called std::next() that does that, or
       /// you can write your own loop.
 
-    _books_sl_list.erase_after(std::next(_books_sl_list.before_begin(), offsetFromTop));
+    auto before = std::next(_books_sl_list.before_begin(), offsetFromTop);
+    _consistency.removed(ConsistencyPolicy::Container::SL_LIST, *std::next(before));
+    _books_sl_list.erase_after(before);
     /////////////////////// END-TO-DO (11) ////////////////////////////
   } // Part 4 - Remove from singly linked list
 
 
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyMutation();
 } // remove( std::size_t offsetFromTop )
 
 
 
 // moveToTop()
-void BookList::moveToTop( const Book & book )
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::moveToTop( const Book & book )
 {
   ///////////////////////// TO-DO (12) //////////////////////////////
     /// If the book exists, then remove and reinsert it.  Otherwise, do nothing.
@@ -379,47 +524,78 @@ void BookList::moveToTop( const Book & book )
     /// Remember, you already have functions to do all this.  Use BookList::find() to determine if the book
     /// exists in this book list, and then remove() and insert() to reposition the book.
 
-  if (find(book) != size()) {
-    remove(book);
-    insert(book);
+  // Removing and reinserting searches twice, shifts the array and vector
+  // twice, walks both lists twice, and checks consistency twice. Moving to
+  // the top only reorders books, so rotate and relink in place instead.
+  const auto offset = find(book);
+  if (offset == size() || offset == 0) return;
+
+  // Array and vector: rotate the moved book to the front. One pass over the
+  // books above it, no copies and no allocation.
+  std::rotate(_books_array.begin(), _books_array.begin() + offset, _books_array.begin() + offset + 1);
+  std::rotate(_books_vector.begin(), _books_vector.begin() + offset, _books_vector.begin() + offset + 1);
+
+  // Doubly linked list: the side-index holds a handle to the node, so this
+  // is a constant time splice. Short lists aren't indexed, but then the walk
+  // is short too.
+  auto node = _books_index.engaged ? _books_index.offsets.find(&book)->second.node
+                                   : std::next(_books_dl_list.cbegin(), offset);
+  _books_dl_list.splice(_books_dl_list.cbegin(), _books_dl_list, node);
+
+  // Singly linked list: relink the node after its predecessor to the front.
+  // Finding the predecessor still takes a walk.
+  _books_sl_list.splice_after(_books_sl_list.cbefore_begin(), _books_sl_list, std::next(_books_sl_list.cbefore_begin(), offset));
+
+  // Everything that was above the book moved down one.
+  if (_books_index.engaged) {
+    _books_index.offsets.find(&book)->second.offset = 0;
+    _books_index.rotated(offset + 1);
   }
   /////////////////////// END-TO-DO (12) ////////////////////////////
+
+  // Verify the internal book list state is still consistent amongst the four containers
+  verifyMutation();
 }
 
 
 
 // operator+=( initializer_list )
-BookList & BookList::operator+=( const std::initializer_list<Book> & rhs )
+template<class ConsistencyCheck>
+BookListType<ConsistencyCheck> & BookListType<ConsistencyCheck>::operator+=( const std::initializer_list<Book> & rhs )
 {
   ///////////////////////// TO-DO (13) //////////////////////////////
     /// Concatenate the right hand side to the bottom of this list by repeatedly inserting at the bottom of this book list. The
     /// input type is a container of books accessible with iterators like all the other containers.  The constructor above gives an
     /// example.  Just like the above example, use BookList::insert() to insert each book of rhs at the bottom of this list.
 
-  for (const auto& add : rhs) insert(add, Position::BOTTOM);
+  // One bulk append instead of a duplicate search, shift, and consistency
+  // check per book.
+  append_range(rhs);
   /////////////////////// END-TO-DO (13) ////////////////////////////
 
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyMutation();
   return *this;
 }
 
 
 
 // operator+=( Booklist )
-BookList & BookList::operator+=( const BookList & rhs )
+template<class ConsistencyCheck>
+BookListType<ConsistencyCheck> & BookListType<ConsistencyCheck>::operator+=( const BookListType & rhs )
 {
   ///////////////////////// TO-DO (14) //////////////////////////////
     /// Concatenate the right hand side to the bottom of this list by repeatedly inserting at the bottom of this book list. All the
     /// rhs containers (array, vector, list, and forward_list) contain the same information, so pick just one to traverse. Walk the
     /// container you picked inserting its books to the bottom of this book list. Use BookList::insert() to insert at the bottom.
 
-  // Choose rhs._books_vector for CPU cache line reasons.
-  for (const auto& add : rhs._books_vector) insert(add, Position::BOTTOM);
+  // Choose rhs._books_vector for CPU cache line reasons. Appending a list to
+  // itself adds nothing, since every book is already there.
+  append_range(rhs._books_vector);
   /////////////////////// END-TO-DO (14) ////////////////////////////
 
   // Verify the internal book list state is still consistent amongst the four containers
-  if( !containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyMutation();
   return *this;
 }
 
@@ -440,9 +616,11 @@ BookList & BookList::operator+=( const BookList & rhs )
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // operator<=>
-std::weak_ordering BookList::operator<=>( BookList const & rhs ) const
+template<class ConsistencyCheck>
+std::weak_ordering BookListType<ConsistencyCheck>::operator<=>( BookListType const & rhs ) const
 {
-  if( !containersAreConsistant() || !rhs.containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyQuery();
+  rhs.verifyQuery();
 
   ///////////////////////// TO-DO (15) //////////////////////////////
     /// Find the common extent.  That is, if one list has 20 books, and the other has only 13, then the common extent is 13 books.
@@ -456,11 +634,15 @@ std::weak_ordering BookList::operator<=>( BookList const & rhs ) const
 
   auto range = std::min(size(), rhs.size());
 
-  // Use decltype(range) to grab range's type and define i to be of the same
-  // type. Using "auto i" will give us a mismatching type.
-  for (decltype(range) i = 0; i < range; i++)
-      if (auto cmp = _books_vector.at(i) <=> rhs._books_vector.at(i); cmp != 0)
-          return cmp;
+  // Skip the common prefix with Book::operator==, which is cheaper than <=>:
+  // it checks price first and each string's length before its bytes, while
+  // <=> has to compare all three strings of every equal book. Walk the
+  // vectors' contiguous storage directly; there's no need for at()'s bounds
+  // checks inside the common extent. Only the first difference needs <=>.
+  const auto * lhsBooks = _books_vector.data();
+  const auto * rhsBooks = rhs._books_vector.data();
+  auto [lhsBook, rhsBook] = std::mismatch(lhsBooks, lhsBooks + range, rhsBooks);
+  if (lhsBook != lhsBooks + range) return *lhsBook <=> *rhsBook;
 
   // Per cppreference, R being std::weak_ordering gives the following
   // behavior:
@@ -476,9 +658,11 @@ std::weak_ordering BookList::operator<=>( BookList const & rhs ) const
 
 
 // operator==
-bool BookList::operator==( BookList const & rhs ) const
+template<class ConsistencyCheck>
+bool BookListType<ConsistencyCheck>::operator==( BookListType const & rhs ) const
 {
-  if( !containersAreConsistant() || !rhs.containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  verifyQuery();
+  rhs.verifyQuery();
 
   ///////////////////////// TO-DO (16) //////////////////////////////
     /// Two lists are different if their sizes are different, or one of their books is different.  Otherwise the lists are equal.
@@ -490,12 +674,13 @@ bool BookList::operator==( BookList const & rhs ) const
   auto sz = size();
   if (sz != rhs.size()) return false;
 
-  // More use of decltype(sz) for the same reason.
-  for (decltype(sz) i = 0; i < sz; i++)
-      if (_books_vector.at(i) != rhs._books_vector.at(i))
-          return false;
+  // Lists holding different books can't be equal, whatever their order. The
+  // digests give that answer in constant time for most unequal lists.
+  if (_books_digest != rhs._books_digest) return false;
 
-  return true;
+  // Same size and same digest: most likely equal, so it's a full walk over
+  // the vectors' contiguous storage, without at()'s bounds checks.
+  return std::equal(_books_vector.data(), _books_vector.data() + sz, rhs._books_vector.data());
   /////////////////////// END-TO-DO (16) ////////////////////////////
 }
 
@@ -516,12 +701,13 @@ bool BookList::operator==( BookList const & rhs ) const
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // containersAreConsistant() const
-bool BookList::containersAreConsistant() const
+template<class ConsistencyCheck>
+bool BookListType<ConsistencyCheck>::containersAreConsistant() const
 {
   // Sizes of all containers must be equal to each other
-  if(    _books_array_size != _books_vector.size()
-      || _books_array_size != _books_dl_list.size()
-      || _books_array_size !=  books_sl_list_size() ) return false;
+  if(    _books_array.size() != _books_vector.size()
+      || _books_array.size() != _books_dl_list.size()
+      || _books_array.size() !=  books_sl_list_size() ) return false;
 
   // Element content and order must be equal to each other
   auto current_array_position   = _books_array  .cbegin();
@@ -548,8 +734,28 @@ bool BookList::containersAreConsistant() const
 
 
 
+// verifyQuery() const
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::verifyQuery() const
+{
+  // Verify the internal book list state is still consistent amongst the four containers, as often as the policy asks for
+  if( !_consistency.query( [this] { return containersAreConsistant(); } ) )   throw InvalidInternalState_Ex( "Container consistency error" exception_location );
+}
+
+
+
+// verifyMutation()
+template<class ConsistencyCheck>
+void BookListType<ConsistencyCheck>::verifyMutation()
+{
+  if( !_consistency.mutation( [this] { return containersAreConsistant(); } ) )   throw InvalidInternalState_Ex( "Container consistency error" exception_location );
+}
+
+
+
 // books_sl_list_size() const
-std::size_t BookList::books_sl_list_size() const
+template<class ConsistencyCheck>
+std::size_t BookListType<ConsistencyCheck>::books_sl_list_size() const
 {
   ///////////////////////// TO-DO (17) //////////////////////////////
     /// Some implementations of a singly linked list maintain the size (number of elements in the list).  std::forward_list does
@@ -571,15 +777,53 @@ std::size_t BookList::books_sl_list_size() const
 
 
 
+// indexed_find() const
+template<class ConsistencyCheck>
+std::size_t BookListType<ConsistencyCheck>::indexed_find( const Book & book ) const
+{
+  // Build the index the first time the list is big enough to need it.
+  if (!_books_index.engaged) {
+    _books_index.offsets.clear();
+    _books_index.offsets.reserve(_books_array.size());
+
+    std::size_t offset = 0;
+    for (auto node = _books_dl_list.cbegin(); node != _books_dl_list.cend(); ++node) {
+      _books_index.offsets.emplace(&*node, typename SideIndex::Entry{offset++, node});
+    }
+
+    _books_index.clean();
+    _books_index.engaged = true;
+  }
+
+  auto found = _books_index.offsets.find(&book);
+  if (found == _books_index.offsets.end()) return _books_array.size();
+
+  // Offsets in the stale window may have shifted since they were recorded.
+  // Renumber the whole window at once so repeated lookups stay O(1).
+  if (_books_index.isStale(found->second.offset)) {
+    auto offset = _books_index.cleanUntil;
+    auto until  = std::min(_books_index.staleUntil, _books_dl_list.size());
+    for (auto node = std::next(_books_dl_list.cbegin(), offset); offset < until; ++node) {
+      _books_index.offsets.find(&*node)->second.offset = offset++;
+    }
+    _books_index.clean();
+  }
+
+  return found->second.offset;
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Non-member functions
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // operator<<
-std::ostream & operator<<( std::ostream & stream, const BookList & bookList )
+template<class ConsistencyCheck>
+std::ostream & operator<<( std::ostream & stream, const BookListType<ConsistencyCheck> & bookList )
 {
-  if( !bookList.containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  bookList.verifyQuery();
 
   unsigned count = 0;
   for( auto && book : bookList._books_sl_list )   stream << '\n' << std::setw(5) << count++ << ":  " << book;
@@ -590,11 +834,42 @@ std::ostream & operator<<( std::ostream & stream, const BookList & bookList )
 
 
 // operator>>
-std::istream & operator>>( std::istream & stream, BookList & bookList )
+template<class ConsistencyCheck>
+std::istream & operator>>( std::istream & stream, BookListType<ConsistencyCheck> & bookList )
 {
-  if( !bookList.containersAreConsistant() )   throw BookList::InvalidInternalState_Ex( "Container consistency error" exception_location );
+  bookList.verifyQuery();
 
-  for( Book book; stream >> book; )   bookList.insert( book, BookList::Position::BOTTOM );
+  for( Book book; stream >> book; )   bookList.insert( book, BookListType<ConsistencyCheck>::Position::BOTTOM );
 
   return stream;
 }
+
+
+
+
+
+
+
+
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Explicit instantiations
+//
+// The member function definitions live here rather than in the header, so each consistency policy a client may use must be
+// instantiated here.  Add a line to each group when adding a policy to ConsistencyPolicy.hpp.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template class BookListType<ConsistencyPolicy::Full     >;
+template class BookListType<ConsistencyPolicy::Sampled<>>;
+template class BookListType<ConsistencyPolicy::Checksum >;
+
+template std::ostream & operator<<( std::ostream & stream, BookListType<ConsistencyPolicy::Full     > const & bookList );
+template std::ostream & operator<<( std::ostream & stream, BookListType<ConsistencyPolicy::Sampled<>> const & bookList );
+template std::ostream & operator<<( std::ostream & stream, BookListType<ConsistencyPolicy::Checksum > const & bookList );
+
+template std::istream & operator>>( std::istream & stream, BookListType<ConsistencyPolicy::Full     > & bookList );
+template std::istream & operator>>( std::istream & stream, BookListType<ConsistencyPolicy::Sampled<>> & bookList );
+template std::istream & operator>>( std::istream & stream, BookListType<ConsistencyPolicy::Checksum > & bookList );
@@ -1,30 +1,44 @@
 #pragma once                                                                                  // include guard
 
-#include <array>
+#include <algorithm>                                                                          // min(), max()
 #include <compare>                                                                            // weak_ordering
 #include <cstddef>                                                                            // size_t
 #include <forward_list>
 #include <initializer_list>
 #include <iostream>
 #include <list>
+#include <span>
 #include <stdexcept>                                                                          // domain_error, length_error, logic_error
+#include <unordered_map>
 #include <vector>
 
 #include "Book.hpp"
+#include "BookHash.hpp"
+#include "ConsistencyPolicy.hpp"
+#include "SmallVector.hpp"
 
 
-class BookList
+template<class ConsistencyCheck> class BookListType;
+template<class ConsistencyCheck> std::ostream & operator<<( std::ostream & stream, BookListType<ConsistencyCheck> const & bookList );
+template<class ConsistencyCheck> std::istream & operator>>( std::istream & stream, BookListType<ConsistencyCheck>       & bookList );
+
+
+// ConsistencyCheck decides how often, and how thoroughly, the four containers are verified against each other.  See
+// ConsistencyPolicy.hpp for the choices.  The member functions are defined in BookList.cpp and explicitly instantiated there
+// for each of those policies.
+template<class ConsistencyCheck>
+class BookListType
 {
   // Insertion and Extraction Operators
-  friend std::ostream & operator<<( std::ostream & stream, BookList const & bookList );
-  friend std::istream & operator>>( std::istream & stream, BookList       & bookList );
+  friend std::ostream & operator<< <>( std::ostream & stream, BookListType const & bookList );
+  friend std::istream & operator>> <>( std::istream & stream, BookListType       & bookList );
 
   public:
     // Types and Exceptions
     enum class Position {TOP, BOTTOM};
 
     struct InvalidInternalState_Ex : std::domain_error { using domain_error::domain_error; }; // Thrown if internal data structures become inconsistent with each other
-    struct CapacityExceeded_Ex     : std::length_error { using length_error::length_error; }; // Thrown if more books are inserted than will fit
+    struct CapacityExceeded_Ex     : std::length_error { using length_error::length_error; }; // Thrown if more books are inserted than can be addressed
     struct InvalidOffset_Ex        : std::logic_error  { using logic_error ::logic_error;  }; // Thrown if inserting beyond current size
 
 
@@ -32,8 +46,8 @@ class BookList
     //
     // The compiler synthesized copy and move constructors, and copy and move assignment operators work just fine.  But since I also
     // have user defined constructors, I need to explicitly say the compiler synthesized default constructor is also okay.
-    BookList() = default;                                                                     // constructs an empty book list
-    BookList( std::initializer_list<Book> const & initList );                                 // constructs a book list from a braced list of books
+    BookListType() = default;                                                                 // constructs an empty book list
+    BookListType( std::initializer_list<Book> const & initList );                             // constructs a book list from a braced list of books
 
 
     // Queries
@@ -48,30 +62,92 @@ class BookList
     void insert( Book const & book, Position    position = Position::TOP );                   // add the book to the top (beginning) or bottom (end) of the book list
     void insert( Book const & book, std::size_t offsetFromTop            );                   // inserts before the existing book currently at that offset
 
+    void insert_range( std::size_t offsetFromTop, std::span<Book const> books );              // inserts all books not already in the list before the book at that offset,
+    void append_range(                            std::span<Book const> books );              // or at the bottom, keeping their order.  Linear in the size of both.
+
     void remove( Book const  & book          );                                               // no change occurs if book not found
     void remove( std::size_t   offsetFromTop );                                               // no change occurs if (zero-based) offsetFromTop >= size()
 
     void moveToTop( Book const & book );                                                      // finds then moves book from its current position to the top of the book list
 
-    BookList & operator+=( std::initializer_list<Book> const & rhs );                         // concatenates a braced list of books to the end of this list
-    BookList & operator+=( BookList                    const & rhs );                         // concatenates the rhs list to the end of this list
+    BookListType & operator+=( std::initializer_list<Book> const & rhs );                     // concatenates a braced list of books to the end of this list
+    BookListType & operator+=( BookListType                const & rhs );                     // concatenates the rhs list to the end of this list
 
 
     // Relational Operators
-    std::weak_ordering operator<=>( BookList const & rhs ) const;
-    bool               operator== ( BookList const & rhs ) const;
+    std::weak_ordering operator<=>( BookListType const & rhs ) const;
+    bool               operator== ( BookListType const & rhs ) const;
 
 
   private:
+    // Types
+    //
+    // Hash side-index from a book's identity to its offset from the top of the list and a handle to its node in _books_dl_list.
+    // Keys point at the books in _books_dl_list since list nodes never move.  Offsets outside the stale window [cleanUntil,
+    // staleUntil) are known to be current.  Inserting or removing anywhere but the bottom shifts everything after it, and moving a
+    // book to the top shifts everything above it, so the window is widened to cover them and renumbered lazily on the next find.
+    //
+    // A copy can't reuse the source's keys (they point into the source's nodes), so copies start disengaged and rebuild on demand.
+    // That keeps BookList's compiler synthesized copy and move operations correct.
+    struct SideIndex
+    {
+      struct Hash  { std::size_t operator()( Book const * book                   ) const noexcept { return BookHash{}( *book ); } };
+      struct Equal { bool        operator()( Book const * lhs, Book const * rhs  ) const noexcept { return *lhs == *rhs;         } };
+
+      struct Entry
+      {
+        std::size_t                     offset;
+        std::list<Book>::const_iterator node;
+      };
+
+      inline static constexpr std::size_t TO_BOTTOM = static_cast<std::size_t>( -1 );
+
+      SideIndex            (                      ) = default;
+      SideIndex            ( SideIndex const &    ) noexcept {}
+      SideIndex            ( SideIndex       &&   ) = default;
+      SideIndex & operator=( SideIndex const &    ) noexcept { offsets.clear();  cleanUntil = 0;  staleUntil = TO_BOTTOM;  engaged = false;  return *this; }
+      SideIndex & operator=( SideIndex       &&   ) = default;
+
+      void shifted( std::size_t from  ) noexcept { cleanUntil = std::min( cleanUntil, from );  staleUntil = TO_BOTTOM; }  // everything at and below from moved
+      void rotated( std::size_t until ) noexcept { staleUntil = cleanUntil == TO_BOTTOM ? until : std::max( staleUntil, until );  cleanUntil = 0; }  // everything above until moved
+      void clean  (                   ) noexcept { cleanUntil = staleUntil = TO_BOTTOM; }
+      bool isStale( std::size_t offset ) const noexcept { return cleanUntil <= offset  &&  offset < staleUntil; }
+
+      std::unordered_map<Book const *, Entry, Hash, Equal> offsets;
+      std::size_t                                          cleanUntil = 0;
+      std::size_t                                          staleUntil = TO_BOTTOM;
+      bool                                                 engaged    = false;
+    };
+
+
+    // Class Attributes
+    inline static constexpr std::size_t INLINE_CAPACITY = 11;                                 // Lists up to this long never allocate for the array
+    inline static constexpr std::size_t INDEX_THRESHOLD = 8;                                  // Below this many books a linear scan beats hashing three strings
+
+
     // Instance Attributes
-    std::size_t             _books_array_size = 0;                                            // std::array's size is constant so manage that attributes ourself
-    std::array<Book, 11>    _books_array;
-    std::vector<Book>       _books_vector;
-    std::list<Book>         _books_dl_list;
-    std::forward_list<Book> _books_sl_list;
+    SmallVector<Book, INLINE_CAPACITY> _books_array;                                          // the "array", stored inline until it outgrows INLINE_CAPACITY books
+    std::vector<Book>                  _books_vector;
+    std::list<Book>                    _books_dl_list;
+    std::forward_list<Book>            _books_sl_list;
+    mutable SideIndex                  _books_index;                                          // maintained by find(), insert(), remove(), and moveToTop()
+    ConsistencyCheck                   _consistency;
+    std::size_t                        _books_digest = 0;                                     // sum of every book's BookHash, so equal lists have equal digests
 
 
     // Helper functions
-    bool        containersAreConsistant() const;
+    bool        containersAreConsistant() const;                                              // the full O(n) check, element by element
+    void        verifyQuery            () const;                                              // ask the consistency policy, throw if inconsistent
+    void        verifyMutation         ();
     std::size_t books_sl_list_size     () const;                                              // std::forward_list doesn't maintain size, so calculate it on demand
+    std::size_t indexed_find           ( Book const & book ) const;                           // find() through the side-index, building or renumbering it as needed
 };
+
+
+
+// Full checks in debug builds, O(1) checksums in release builds
+#ifdef NDEBUG
+  using BookList = BookListType<ConsistencyPolicy::Checksum>;
+#else
+  using BookList = BookListType<ConsistencyPolicy::Full>;
+#endif
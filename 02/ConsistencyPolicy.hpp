@@ -0,0 +1,75 @@
+#pragma once                                                                                  // include guard
+
+#include <array>
+#include <cstddef>                                                                            // size_t
+
+#include "Book.hpp"
+#include "BookHash.hpp"
+
+
+// How often, and how thoroughly, a BookList verifies its four containers agree with each other.  A BookList asks its policy
+//   query()     at the start of every read-only operation (size, find, comparisons, insertion and extraction)
+//   mutation()  at the end of every modifying operation (insert, remove, concatenation, construction)
+// passing along a callable that performs the full element-by-element check, and tells its policy about every book added to or
+// removed from each container so policies that keep running totals can maintain them.  Each returns false if the containers are
+// known to be inconsistent.
+namespace ConsistencyPolicy
+{
+  enum class Container { ARRAY, VECTOR, DL_LIST, SL_LIST };
+
+
+
+  // Walk all four containers on every operation.  O(n) per operation, even for size().  The original behavior, and the default
+  // for debug builds.
+  struct Full
+  {
+    bool query   ( auto && fullCheck ) const { return fullCheck(); }
+    bool mutation( auto && fullCheck )       { return fullCheck(); }
+
+    void added  ( Container, Book const & ) noexcept {}
+    void removed( Container, Book const & ) noexcept {}
+  };
+
+
+
+  // Walk all four containers after every Interval-th mutation, and never on queries.  Amortizes the full check to O(n / Interval)
+  // per mutation, but an inconsistency may go unnoticed for up to Interval - 1 mutations.
+  template<std::size_t Interval = 64>
+  struct Sampled
+  {
+    bool query   ( auto &&           ) const { return true; }
+    bool mutation( auto && fullCheck )       { return ++_mutations % Interval != 0  ||  fullCheck(); }
+
+    void added  ( Container, Book const & ) noexcept {}
+    void removed( Container, Book const & ) noexcept {}
+
+    private:
+      std::size_t _mutations = 0;
+  };
+
+
+
+  // Keep a running element count and an order independent checksum (sum of BookHash) for each container, updated in O(1) as books
+  // are added and removed, and compare the four on every operation.  Catches a container missing, duplicating, or holding a
+  // different book, but not books that are all present in a different order.  The default for release (NDEBUG) builds.
+  struct Checksum
+  {
+    bool query   ( auto && ) const { return agree(); }
+    bool mutation( auto && ) const { return agree(); }
+
+    void added  ( Container container, Book const & book ) noexcept { ++_sizes[index( container )];  _sums[index( container )] += BookHash{}( book ); }
+    void removed( Container container, Book const & book ) noexcept { --_sizes[index( container )];  _sums[index( container )] -= BookHash{}( book ); }
+
+    private:
+      static constexpr std::size_t index( Container container ) noexcept { return static_cast<std::size_t>( container ); }
+
+      bool agree() const noexcept
+      {
+        for( std::size_t i = 1; i < _sizes.size(); ++i )   if( _sizes[i] != _sizes[0]  ||  _sums[i] != _sums[0] )   return false;
+        return true;
+      }
+
+      std::array<std::size_t, 4> _sizes = {};
+      std::array<std::size_t, 4> _sums  = {};                                                 // unsigned, so wrap around on overflow is well defined
+  };
+}    // namespace ConsistencyPolicy
@@ -0,0 +1,246 @@
+#pragma once                                                                                  // include guard
+
+#include <array>
+#include <bit>                                                                                // countr_zero()
+#include <cstddef>                                                                            // size_t
+#include <cstdint>                                                                            // uint64_t
+#include <initializer_list>
+#include <iterator>                                                                           // forward_iterator_tag
+#include <memory>                                                                             // unique_ptr
+#include <stdexcept>                                                                          // out_of_range
+#include <string>
+#include <type_traits>                                                                        // is_same_v
+#include <utility>                                                                            // move(), swap()
+
+
+// A sequence container that, like std::vector, is indexed by position, but that, like std::list, inserts and erases anywhere
+// without shifting the elements after it.  Access, insertion, and removal at any position are all O(log n) expected.
+//
+// It's a skip list (W. Pugh, 1990) where every forward link also records its width, the number of elements it skips over.  A
+// position is found by walking down from the sparsest level and adding up widths on the way, and an insertion or removal only
+// adjusts the widths of the links that pass over it.  Elements live in their own nodes and never move, so pointers and
+// iterators to them stay valid until that element is erased.
+template<typename T>
+class IndexableSkipList
+{
+  private:
+    struct Node;
+
+  public:
+    // Types
+    template<typename Value>
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Value *;
+        using reference         = Value &;
+
+        Iterator() = default;
+        Iterator( Iterator<T> const & other ) requires( !std::is_same_v<Value, T> ) : _node( other._node ) {}   // iterator -> const_iterator
+
+        reference  operator* () const { return  _node->value; }
+        pointer    operator->() const { return &_node->value; }
+        Iterator & operator++()       { _node = _node->next[0].node;  return *this; }
+        Iterator   operator++( int )  { auto previous = *this;  ++*this;  return previous; }
+
+        bool operator==( Iterator const & ) const = default;
+
+      private:
+        friend class IndexableSkipList;
+        template<typename> friend class Iterator;
+
+        explicit Iterator( Node * node ) : _node( node ) {}
+        Node * _node = nullptr;
+    };
+
+    using value_type     = T;
+    using iterator       = Iterator<T>;
+    using const_iterator = Iterator<T const>;
+
+
+    // Constructors, destructor, and assignments
+    IndexableSkipList() = default;
+    IndexableSkipList( std::initializer_list<T> initList )           { for( auto && value : initList ) push_back( value ); }
+    IndexableSkipList( IndexableSkipList const & other )             { for( auto && value : other    ) push_back( value ); }
+    IndexableSkipList( IndexableSkipList && other ) noexcept         { swap( other ); }
+
+    IndexableSkipList & operator=( IndexableSkipList const & rhs )          { if( this != &rhs ) { IndexableSkipList copy( rhs );  swap( copy ); }             return *this; }
+    IndexableSkipList & operator=( IndexableSkipList &&      rhs ) noexcept { if( this != &rhs ) { IndexableSkipList temp( std::move( rhs ) );  swap( temp ); }  return *this; }
+
+    ~IndexableSkipList() noexcept { clear(); }
+
+
+    // Queries
+    std::size_t size () const noexcept { return _size;      }
+    bool        empty() const noexcept { return _size == 0; }
+
+
+    // Accessors
+    T       & operator[]( std::size_t position )       { return nodeAt( position )->value; }
+    T const & operator[]( std::size_t position ) const { return nodeAt( position )->value; }
+
+    T       & at( std::size_t position )       { checkPosition( position, _size );  return nodeAt( position )->value; }
+    T const & at( std::size_t position ) const { checkPosition( position, _size );  return nodeAt( position )->value; }
+
+    T       & front()       { return _head.next[0].node->value; }
+    T const & front() const { return _head.next[0].node->value; }
+
+    iterator       begin ()       noexcept { return iterator      ( _head.next[0].node ); }
+    iterator       end   ()       noexcept { return iterator      (                    ); }
+    const_iterator begin () const noexcept { return const_iterator( _head.next[0].node ); }
+    const_iterator end   () const noexcept { return const_iterator(                    ); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend  () const noexcept { return end();   }
+
+
+    // Modifiers
+    iterator insert( std::size_t position, T value )                                          // inserts before the element currently at position
+    {
+      checkPosition( position, _size + 1 );
+
+      Path path = pathTo( position );
+      auto node = new Node( std::move( value ), randomLevel() );
+
+      // Ranks count from 1 at the first element, so the head is rank 0 and the (virtual) end is rank size() + 1.  A link from rank
+      // r with width w reaches rank r + w.
+      const std::size_t rank = position + 1;
+      for( std::size_t level = 0; level < MAX_LEVEL; ++level )
+      {
+        Link & link = path.nodes[level]->next[level];
+
+        if( level < node->level )
+        {
+          node->next[level] = { link.node, link.width + path.ranks[level] - position };       // the new node now links to where its predecessor did
+          link              = { node,      rank - path.ranks[level]                 };        // and its predecessor links to it
+        }
+        else ++link.width;                                                                    // links passing over the new node skip one more
+      }
+
+      ++_size;
+      return iterator( node );
+    }
+
+    void erase( std::size_t position )                                                        // no change occurs if position >= size()
+    {
+      if( position >= _size )   return;
+
+      Path   path   = pathTo( position );
+      Node * target = path.nodes[0]->next[0].node;
+
+      for( std::size_t level = 0; level < MAX_LEVEL; ++level )
+      {
+        Link & link = path.nodes[level]->next[level];
+
+        if( level < target->level ) link = { target->next[level].node, link.width + target->next[level].width - 1 };
+        else                        --link.width;
+      }
+
+      delete target;
+      --_size;
+    }
+
+    void push_front( T value ) { insert( 0,     std::move( value ) ); }
+    void push_back ( T value ) { insert( _size, std::move( value ) ); }
+
+    void clear() noexcept
+    {
+      for( Node * node = _head.next[0].node; node != nullptr; )
+      {
+        Node * next = node->next[0].node;
+        delete node;
+        node = next;
+      }
+
+      for( std::size_t level = 0; level < MAX_LEVEL; ++level ) _head.next[level] = {};
+      _size = 0;
+    }
+
+    void swap( IndexableSkipList & other ) noexcept
+    {
+      std::swap( _head,   other._head   );
+      std::swap( _size,   other._size   );
+      std::swap( _random, other._random );
+    }
+
+
+    // Relational Operators
+    bool operator==( IndexableSkipList const & rhs ) const
+    {
+      if( _size != rhs._size ) return false;
+      for( auto i = begin(), j = rhs.begin(); i != end(); ++i, ++j )   if( !( *i == *j ) ) return false;
+      return true;
+    }
+
+
+  private:
+    // Class Attributes
+    inline static constexpr std::size_t MAX_LEVEL = 16;                                       // with p = 1/4, comfortably past 4^16 (~4 billion) elements
+
+    // Types
+    struct Link
+    {
+      Node *      node  = nullptr;                                                            // nullptr links to the end
+      std::size_t width = 1;                                                                  // number of ranks this link advances
+    };
+
+    struct Node
+    {
+      Node( T data, std::size_t levels ) : value( std::move( data ) ), level( levels ), next( std::make_unique<Link[]>( levels ) ) {}
+
+      T                       value;
+      std::size_t             level;                                                          // number of links, 1 to MAX_LEVEL
+      std::unique_ptr<Link[]> next;                                                           // sized to the node's level, averaging 4/3 links
+    };
+
+    struct Path                                                                               // the last node, and its rank, at each level before a position
+    {
+      std::array<Node *,      MAX_LEVEL> nodes;
+      std::array<std::size_t, MAX_LEVEL> ranks;
+    };
+
+
+    // Helper functions
+    static void checkPosition( std::size_t position, std::size_t limit )
+    {
+      if( position >= limit )   throw std::out_of_range( "IndexableSkipList position " + std::to_string( position ) + " out of range" );
+    }
+
+    // Walks down from the top level recording, at each level, the last node at or before rank target
+    Path pathTo( std::size_t target ) const
+    {
+      Path        path;
+      Node *      node = const_cast<Node *>( &_head );                                        // only handed out as const by the const accessors
+      std::size_t rank = 0;
+
+      for( std::size_t level = MAX_LEVEL; level-- > 0; )
+      {
+        while( node->next[level].node != nullptr  &&  rank + node->next[level].width <= target )
+        {
+          rank += node->next[level].width;
+          node  = node->next[level].node;
+        }
+        path.nodes[level] = node;
+        path.ranks[level] = rank;
+      }
+      return path;
+    }
+
+    Node * nodeAt( std::size_t position ) const { return pathTo( position + 1 ).nodes[0]; }
+
+    // Geometric distribution with p = 1/4:  each pair of trailing zero bits in a random word promotes the node one more level
+    std::size_t randomLevel()
+    {
+      _random ^= _random << 13;  _random ^= _random >> 7;  _random ^= _random << 17;          // xorshift64
+      auto level = 1 + static_cast<std::size_t>( std::countr_zero( _random | ( 1ULL << 62 ) ) ) / 2;
+      return level < MAX_LEVEL ? level : MAX_LEVEL;
+    }
+
+
+    // Instance Attributes
+    Node          _head   = { T{}, MAX_LEVEL };                                               // sentinel at rank 0, linked at every level; its value is never used
+    std::size_t   _size   = 0;
+    std::uint64_t _random = 0x9E3779B97F4A7C15ULL;
+};
@@ -0,0 +1,90 @@
+#include <chrono>                                 // steady_clock, duration
+#include <cstddef>                                // size_t
+#include <iomanip>                                // setw()
+#include <iostream>
+#include <iterator>                               // next()
+#include <list>
+#include <random>
+#include <string>                                 // to_string()
+#include <utility>                                // move()
+#include <vector>
+
+#include "Book.hpp"
+#include "IndexableSkipList.hpp"
+#include "ReadingListBenchmark.hpp"
+
+
+
+
+namespace    // anonymous
+{
+  // Offset based insert and remove for each backend, written the way BookList does them
+  void insertAt( std::vector<Book> & books, std::size_t offset, Book book ) { books.insert( books.begin() + static_cast<std::ptrdiff_t>( offset ), std::move( book ) ); }
+  void insertAt( std::list<Book>   & books, std::size_t offset, Book book ) { books.insert( std::next( books.begin(), static_cast<std::ptrdiff_t>( offset ) ), std::move( book ) ); }
+  void insertAt( IndexableSkipList<Book> & books, std::size_t offset, Book book ) { books.insert( offset, std::move( book ) ); }
+
+  Book takeAt( std::vector<Book> & books, std::size_t offset )
+  {
+    auto position = books.begin() + static_cast<std::ptrdiff_t>( offset );
+    Book book     = std::move( *position );
+    books.erase( position );
+    return book;
+  }
+
+  Book takeAt( std::list<Book> & books, std::size_t offset )
+  {
+    auto position = std::next( books.begin(), static_cast<std::ptrdiff_t>( offset ) );
+    Book book     = std::move( *position );
+    books.erase( position );
+    return book;
+  }
+
+  Book takeAt( IndexableSkipList<Book> & books, std::size_t offset )
+  {
+    Book book = std::move( books[offset] );
+    books.erase( offset );
+    return book;
+  }
+
+
+
+  template<class Container>
+  void run( std::string const & name, std::size_t entries, std::size_t operations, std::ostream & stream )
+  {
+    using Seconds = std::chrono::duration<double>;
+
+    Container    books;
+    std::mt19937 random( 131 );                                                             // same seed, so every backend sees the same workload
+
+    auto start = std::chrono::steady_clock::now();
+    for( std::size_t i = 0; i < entries; ++i ) books.push_back( Book{ "Book-" + std::to_string( i ) } );                // appending is cheap for all of them
+    Seconds build = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for( std::size_t i = 0; i < operations; ++i )
+    {
+      std::size_t offset = random() % ( books.size() + 1 );
+
+      if( i % 2 == 0  ||  offset == books.size() )  insertAt( books, offset, Book{ "New-" + std::to_string( i ) } );   // mid-list insert
+      else                                          insertAt( books, 0, takeAt( books, offset ) );                      // moveToTop
+    }
+    Seconds edit = std::chrono::steady_clock::now() - start;
+
+    stream << std::setw( 22 ) << name << std::setw( 14 ) << build.count() << std::setw( 14 ) << edit.count()
+           << std::setw( 14 ) << edit.count() / static_cast<double>( operations ) * 1e6 << '\n';
+  }
+}    // namespace
+
+
+
+
+void runReadingListBenchmark( std::size_t entries, std::size_t operations, std::ostream & stream )
+{
+  stream << "Reading list benchmark:  " << entries << " entries, " << operations << " random mid-list inserts and moves to top\n\n"
+         << std::setw( 22 ) << "Backend" << std::setw( 14 ) << "Build (s)" << std::setw( 14 ) << "Edits (s)" << std::setw( 14 ) << "us per edit" << '\n'
+         << std::fixed << std::setprecision( 4 );
+
+  run<std::vector<Book>>      ( "std::vector",       entries, operations, stream );
+  run<std::list<Book>>        ( "std::list",         entries, operations, stream );
+  run<IndexableSkipList<Book>>( "IndexableSkipList", entries, operations, stream );
+}
@@ -0,0 +1,10 @@
+#pragma once                                                                                  // include guard
+
+#include <cstddef>                                                                            // size_t
+#include <iostream>
+
+
+// Times a reading list workload against each candidate BookList backend:  build a list of "entries" books, then perform
+// "operations" random edits, half inserting a new book at a random offset and half moving the book at a random offset to the
+// top.  Results are written to stream as one line per backend.
+void runReadingListBenchmark( std::size_t entries = 1'000'000, std::size_t operations = 1'000, std::ostream & stream = std::cout );
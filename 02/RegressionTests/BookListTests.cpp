@@ -1,7 +1,9 @@
 #include <exception>
 #include <iomanip>     // setprecision()
 #include <iostream>    // boolalpha(), showpoint(), fixed()
+#include <span>
 #include <string>      // to_string()
+#include <vector>
 
 #include "CheckResults.hpp"
 #include "BookList.hpp"
@@ -44,6 +46,16 @@ namespace    // anonymous
       BookList list3 = { book_3, book_1, book_4, book_5 };
       affirm.is_less_than   ("Relational 1", list1, list3);
       affirm.is_greater_than("Relational 2", list3, list1);
+
+      BookList reordered = { book_4, book_3, book_1, book_2 };
+      BookList rebuilt   = { book_1, book_4 };
+      rebuilt.insert( book_2 );
+      rebuilt.insert( book_3, 1 );
+      rebuilt.remove( book_1 );
+      rebuilt.insert( book_1, 2 );
+      affirm.is_true        ("Relational 3 - same books, different order", list1 != reordered && list1 < reordered );
+      affirm.is_equal       ("Relational 4 - same books, different history", list1, rebuilt);
+      affirm.is_less_than   ("Relational 5 - prefix", BookList{ book_2, book_3 }, list1);
     }
 
     {
@@ -133,18 +145,116 @@ namespace    // anonymous
     }
 
     {
+      // Long enough lists search through a hash side-index.  Offsets must still track inserts, removes, and moves mid-list.
+      BookList list;
+      for( unsigned i = 0; i < 10; ++i ) list.insert( Book{ "Book-" + std::to_string( i ) }, BookList::Position::BOTTOM );
+
+      list.insert( {"Middle"}, 3 );                       // 0 1 2 M 3 4 5 6 7 8 9
+      list.remove( 5 );                                   // 0 1 2 M 3 5 6 7 8 9
+      list.moveToTop( {"Book-8"} );                       // 8 0 1 2 M 3 5 6 7 9
+      list.insert( {"Book-3"} );                          // duplicate, ignored
+
+      affirm.is_equal( "Indexed search - size",             10U, list.size()                );
+      affirm.is_equal( "Indexed search - moved to top",      0U, list.find( {"Book-8"}    ) );
+      affirm.is_equal( "Indexed search - inserted mid-list", 4U, list.find( {"Middle"}    ) );
+      affirm.is_equal( "Indexed search - bottom",            9U, list.find( {"Book-9"}    ) );
+      affirm.is_equal( "Indexed search - removed",          10U, list.find( {"Book-4"}    ) );
+      affirm.is_equal( "Indexed search - not there",        10U, list.find( {"not there"} ) );
+
+      BookList copy = list;
+      copy.remove( {"Book-0"} );
+      affirm.is_equal( "Indexed search - copy is independent",   8U, copy.find( {"Book-9"} ) );
+      affirm.is_equal( "Indexed search - original is unchanged", 9U, list.find( {"Book-9"} ) );
+    }
+
+    {
+      // Moving to the top relinks nodes through the side-index's handles.  Later finds, removes, and inserts must see the new order.
       BookList list;
+      for( unsigned i = 0; i < 20; ++i ) list.insert( Book{ "Book-" + std::to_string( i ) }, BookList::Position::BOTTOM );
+
+      list.moveToTop( {"Book-5"}  );                      // 5 0 1 2 3 4 6 ...
+      list.moveToTop( {"Book-12"} );                      // 12 5 0 1 2 3 4 6 ... 11 13 ...
+      list.moveToTop( {"Book-0"}  );                      // 0 12 5 1 2 3 4 6 ... 11 13 ...
+      list.moveToTop( {"Book-0"}  );                      // already on top
+
+      affirm.is_equal( "Indexed move to top - top",        0U, list.find( {"Book-0"}  ) );
+      affirm.is_equal( "Indexed move to top - moved down", 2U, list.find( {"Book-5"}  ) );
+      affirm.is_equal( "Indexed move to top - unaffected", 13U, list.find( {"Book-13"} ) );
+
+      list.remove( 1 );                                   // 0 5 1 2 ...
+      list.insert( {"New"}, 2 );                          // 0 5 New 1 2 ...
+      list.moveToTop( {"Book-19"} );
+
+      BookList expected = { {"Book-19"}, {"Book-0"}, {"Book-5"}, {"New"} };
+      for( unsigned i = 1; i < 19; ++i ) if( i != 5 && i != 12 ) expected.insert( Book{ "Book-" + std::to_string( i ) }, BookList::Position::BOTTOM );
+
+      affirm.is_equal( "Indexed move to top - content",    expected, list );
+      affirm.is_equal( "Indexed move to top - find after", 3U, list.find( {"New"} ) );
+    }
+
+    {
+      // Every consistency policy must give the same results
+      BookListType<ConsistencyPolicy::Full>      full    = {book_2, book_1, book_4};
+      BookListType<ConsistencyPolicy::Sampled<>> sampled = {book_2, book_1, book_4};
+      BookListType<ConsistencyPolicy::Checksum>  summed  = {book_2, book_1, book_4};
+
+      full   .moveToTop( book_4 );  full   .remove( book_1 );  full   .insert( book_5, 2 );
+      sampled.moveToTop( book_4 );  sampled.remove( book_1 );  sampled.insert( book_5, 2 );
+      summed .moveToTop( book_4 );  summed .remove( book_1 );  summed .insert( book_5, 2 );
+
+      affirm.is_equal( "Consistency policy - full",     decltype( full    ){book_4, book_2, book_5}, full    );
+      affirm.is_equal( "Consistency policy - sampled",  decltype( sampled ){book_4, book_2, book_5}, sampled );
+      affirm.is_equal( "Consistency policy - checksum", decltype( summed  ){book_4, book_2, book_5}, summed  );
+    }
+
+    {
+      BookList list = {book_1, book_2};
+      const Book batch[] = {book_4, book_2, book_5, book_4, book_3};
+
+      list.insert_range( 1, batch );                      // book_2 already there, second book_4 a duplicate within the batch
+      affirm.is_equal( "Bulk insert - mid-list, duplicates dropped", BookList {book_1, book_4, book_5, book_3, book_2}, list );
+
+      list.append_range( batch );
+      affirm.is_equal( "Bulk insert - all duplicates",              BookList {book_1, book_4, book_5, book_3, book_2}, list );
+
+      list += list;
+      affirm.is_equal( "Bulk insert - concatenate with itself",     BookList {book_1, book_4, book_5, book_3, book_2}, list );
 
       try
       {
-        for( unsigned i = 0; i < 100; ++i ) list.insert( Book{ "Book-" + std::to_string( i ) } );
-        affirm.is_true( "Fixed size array capacity check", false );
+        list.insert_range( 6, batch );
+        affirm.is_true( "Bulk insert - offset past the end", false );
       }
-      catch ( const BookList::CapacityExceeded_Ex & )  // expected
+      catch( const BookList::InvalidOffset_Ex & )  // expected
       {
-        affirm.is_true( "Fixed size array capacity check", true );
+        affirm.is_true( "Bulk insert - offset past the end", true );
       }
     }
+
+    {
+      // Past the array's inline capacity the books move to the heap, and past the index threshold finds go through the side-index
+      std::vector<Book> books;
+      for( unsigned i = 0; i < 1000; ++i ) books.emplace_back( "Book-" + std::to_string( i ) );
+
+      BookList list;
+      list.append_range( std::span( books ).first( 500 ) );
+      list.find( books[0] );                              // engage the side-index
+      list.append_range( books );
+      list.insert( {"Top"} );
+
+      affirm.is_equal( "Bulk insert - large append, size",   1001U, list.size()            );
+      affirm.is_equal( "Bulk insert - large append, first",     1U, list.find( books[0]   ) );
+      affirm.is_equal( "Bulk insert - large append, last",   1000U, list.find( books[999] ) );
+    }
+
+    {
+      BookList list;
+      for( unsigned i = 0; i < 100; ++i ) list.insert( Book{ "Book-" + std::to_string( i ) } );
+
+      affirm.is_equal( "Growable array capacity check - size",   100U, list.size()                );
+      affirm.is_equal( "Growable array capacity check - top",      0U, list.find( {"Book-99"} )   );
+      affirm.is_equal( "Growable array capacity check - bottom",  99U, list.find( {"Book-0"}  )   );
+    }
   }
 
 
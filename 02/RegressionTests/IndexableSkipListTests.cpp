@@ -0,0 +1,118 @@
+#include <cstddef>     // size_t
+#include <exception>
+#include <iostream>    // clog
+#include <random>
+#include <stdexcept>   // out_of_range
+#include <string>      // to_string()
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "Book.hpp"
+#include "IndexableSkipList.hpp"
+
+namespace    // anonymous
+{
+  class IndexableSkipListRegressionTest
+  {
+    public:
+      IndexableSkipListRegressionTest();
+
+    private:
+      void test();
+
+      Regression::CheckResults affirm;
+  } run_indexableSkipList_tests;
+
+
+
+
+  void IndexableSkipListRegressionTest::test()
+  {
+    {
+      IndexableSkipList<Book> list = { {"book_1"}, {"book_2"}, {"book_3"} };
+      list.insert( 1, {"book_4"} );                       // 1 4 2 3
+      list.push_front( {"book_5"} );                      // 5 1 4 2 3
+      list.erase( 3 );                                    // 5 1 4 3
+      list.erase( 10 );                                   // no change
+
+      affirm.is_equal( "Skip list - size",   4U,                 list.size() );
+      affirm.is_equal( "Skip list - top",    Book{ "book_5" },   list[0]     );
+      affirm.is_equal( "Skip list - middle", Book{ "book_4" },   list[2]     );
+      affirm.is_equal( "Skip list - bottom", Book{ "book_3" },   list.at(3)  );
+
+      IndexableSkipList<Book> copy = list;
+      copy.erase( 0 );
+      affirm.is_equal( "Skip list - copy is independent", 4U, list.size() );
+      affirm.is_true ( "Skip list - equality",            copy != list && copy == IndexableSkipList<Book>{ {"book_1"}, {"book_4"}, {"book_3"} } );
+
+      try
+      {
+        list.at( 4 );
+        affirm.is_true( "Skip list - position out of range", false );
+      }
+      catch( const std::out_of_range & )  // expected
+      {
+        affirm.is_true( "Skip list - position out of range", true );
+      }
+    }
+
+    {
+      // Random inserts, removals, and moves to the top, checked against std::vector doing the same thing the slow way
+      std::mt19937                       random( 131 );
+      std::vector<unsigned>              expected;
+      IndexableSkipList<unsigned>        actual;
+
+      for( unsigned i = 0; i < 5'000; ++i )
+      {
+        std::size_t position = random() % ( expected.size() + 1 );
+        switch( random() % 4 )
+        {
+          case 0:
+          case 1:  expected.insert( expected.begin() + static_cast<std::ptrdiff_t>( position ), i );  actual.insert( position, i );  break;
+
+          case 2:  if( position < expected.size() ) expected.erase( expected.begin() + static_cast<std::ptrdiff_t>( position ) );
+                   actual.erase( position );
+                   break;
+
+          default: if( position < expected.size() )
+                   {
+                     auto value = expected[position];
+                     expected.erase( expected.begin() + static_cast<std::ptrdiff_t>( position ) );  expected.insert( expected.begin(), value );
+                     actual.erase( position );                                                       actual.push_front( value );
+                   }
+                   break;
+        }
+      }
+
+      bool sameByPosition = actual.size() == expected.size();
+      for( std::size_t i = 0; sameByPosition && i < expected.size(); ++i ) sameByPosition = actual[i] == expected[i];
+
+      bool sameByIteration = true;
+      auto current         = expected.begin();
+      for( auto value : actual ) sameByIteration = sameByIteration && value == *current++;
+
+      affirm.is_equal( "Random operations - size",            expected.size(), actual.size() );
+      affirm.is_true ( "Random operations - by position",     sameByPosition                 );
+      affirm.is_true ( "Random operations - by iteration",    sameByIteration                );
+    }
+  }
+
+
+
+
+  IndexableSkipListRegressionTest::IndexableSkipListRegressionTest()
+  {
+    try
+    {
+      std::clog << "\nIndexable Skip List Regression Tests:\n";
+      test();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class IndexableSkipList\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+}    // namespace
@@ -0,0 +1,126 @@
+#pragma once                                                                                  // include guard
+
+#include <algorithm>                                                                          // move(), copy(), fill()
+#include <array>
+#include <cstddef>                                                                            // size_t
+#include <limits>                                                                             // numeric_limits
+#include <memory>                                                                             // unique_ptr
+#include <stdexcept>                                                                          // out_of_range, length_error
+#include <string>
+#include <utility>                                                                            // swap()
+
+
+// A contiguous, growable sequence that keeps its first N elements inside the object itself and only goes to the heap once it
+// outgrows them.  Short sequences never allocate, and long ones behave like std::vector.  Like std::array, every slot up to
+// capacity() holds a default constructed T, so T must be default constructible and move assignable.
+template<typename T, std::size_t N>
+class SmallVector
+{
+  public:
+    // Types
+    using value_type     = T;
+    using iterator       = T *;
+    using const_iterator = T const *;
+
+
+    // Constructors, destructor, and assignments
+    SmallVector() = default;
+
+    SmallVector( SmallVector const & other )
+    {
+      reserve( other._size );
+      std::copy( other.begin(), other.end(), begin() );
+      _size = other._size;
+    }
+
+    SmallVector( SmallVector && other ) noexcept
+    {
+      if( other._heap )                                                                       // steal the heap buffer
+      {
+        _heap     = std::move( other._heap );
+        _capacity = other._capacity;
+      }
+      else   std::move( other.begin(), other.end(), begin() );                                // inline elements have to be moved one at a time
+
+      _size           = other._size;
+      other._size     = 0;
+      other._capacity = N;
+    }
+
+    SmallVector & operator=( SmallVector const & rhs ) { if( this != &rhs ) { SmallVector copy( rhs );  swap( copy ); }             return *this; }
+    SmallVector & operator=( SmallVector &&      rhs ) noexcept { if( this != &rhs ) { SmallVector temp( std::move( rhs ) );  swap( temp ); }  return *this; }
+
+    ~SmallVector() = default;
+
+
+    // Queries
+    std::size_t size    () const noexcept { return _size;     }
+    std::size_t capacity() const noexcept { return _capacity; }
+    bool        empty   () const noexcept { return _size == 0; }
+    bool        isInline() const noexcept { return !_heap;    }                               // true while still within the first N elements
+
+    static constexpr std::size_t max_size() noexcept { return std::numeric_limits<std::size_t>::max() / sizeof( T ); }
+
+
+    // Accessors
+    T       * data()       noexcept { return _heap ? _heap.get() : _inline.data(); }
+    T const * data() const noexcept { return _heap ? _heap.get() : _inline.data(); }
+
+    iterator       begin ()       noexcept { return data();         }
+    iterator       end   ()       noexcept { return data() + _size; }
+    const_iterator begin () const noexcept { return data();         }
+    const_iterator end   () const noexcept { return data() + _size; }
+    const_iterator cbegin() const noexcept { return begin();        }
+    const_iterator cend  () const noexcept { return end();          }
+
+    T       & operator[]( std::size_t index )       noexcept { return data()[index]; }
+    T const & operator[]( std::size_t index ) const noexcept { return data()[index]; }
+
+    T       & at( std::size_t index )       { checkIndex( index );  return data()[index]; }
+    T const & at( std::size_t index ) const { checkIndex( index );  return data()[index]; }
+
+
+    // Modifiers
+    void reserve( std::size_t newCapacity )                                                   // never shrinks, and never moves back inline
+    {
+      if( newCapacity <= _capacity )   return;
+      if( newCapacity >  max_size() )  throw std::length_error( "SmallVector capacity exceeds max_size()" );
+
+      auto buffer = std::make_unique<T[]>( newCapacity );
+      std::move( begin(), end(), buffer.get() );
+
+      _heap     = std::move( buffer );
+      _capacity = newCapacity;
+    }
+
+    void resize( std::size_t newSize )                                                        // grows geometrically, and default constructs new elements
+    {
+      if( newSize > _capacity )   reserve( std::max( newSize, _capacity * 2 ) );
+
+      if( newSize < _size )   std::fill( begin() + newSize, end(), T{} );                     // release whatever the removed elements were holding on to
+      _size = newSize;
+    }
+
+    void clear() { resize( 0 ); }
+
+    void swap( SmallVector & other ) noexcept
+    {
+      std::swap( _inline,   other._inline   );
+      std::swap( _heap,     other._heap     );
+      std::swap( _size,     other._size     );
+      std::swap( _capacity, other._capacity );
+    }
+
+
+  private:
+    void checkIndex( std::size_t index ) const
+    {
+      if( index >= _size )   throw std::out_of_range( "SmallVector index " + std::to_string( index ) + " >= size " + std::to_string( _size ) );
+    }
+
+    // Instance Attributes
+    std::array<T, N>     _inline   = {};                                                      // used until the first N elements are exceeded
+    std::unique_ptr<T[]> _heap;                                                               // used after that
+    std::size_t          _size     = 0;
+    std::size_t          _capacity = N;
+};
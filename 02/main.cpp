@@ -1,9 +1,12 @@
+#include <cstddef>                                // size_t
 #include <exception>
 #include <iostream>
+#include <string>
 #include <typeinfo>
 
 #include "Book.hpp"
 #include "BookList.hpp"
+#include "ReadingListBenchmark.hpp"
 
 
 
@@ -75,10 +78,19 @@ namespace
 
 
 
-int main()
+int main( int argc, char * argv[] )
 {
   try
   {
+    // "main --benchmark [entries [operations]]" times the candidate list backends instead of running the scenarios
+    if( argc > 1  &&  std::string( argv[1] ) == "--benchmark" )
+    {
+      std::size_t entries    = argc > 2 ? std::stoul( argv[2] ) : 1'000'000;
+      std::size_t operations = argc > 3 ? std::stoul( argv[3] ) :     1'000;
+      runReadingListBenchmark( entries, operations );
+      return 0;
+    }
+
     basicScenario();
 
 
@@ -0,0 +1,44 @@
+/***********************************************************************************************************************************
+** Class BloomFilter - A blocked ("split block") Bloom filter, a compact set of keys that answers "definitely not here" or "maybe"
+**
+**      Utilities::BloomFilter isbns( expectedKeys );
+**      isbns.insert( "0001034359" );
+**      if( !isbns.mayContain( isbn ) ) ...                 // isbn was certainly never inserted, no need to search for it
+**
+**  Each key hashes to one 64-byte block, one cache line, and sets one bit in each of the block's eight words, so whether a key is
+**  present or not, a query reads exactly one cache line.  At the default 10 bits per key, about 1% of keys never inserted answer
+**  "maybe."  Keys can't be removed, so a filter over a set that loses keys only answers "maybe" more often than it needs to.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <string_view>
+#include <vector>
+
+
+
+
+
+namespace Utilities
+{
+  class BloomFilter
+  {
+    public:
+      // Constructors
+      explicit BloomFilter( std::size_t expectedKeys = 0, double bitsPerKey = 10.0 );
+
+      // Modifiers
+      void insert( std::string_view key ) noexcept;
+
+      // Queries
+      bool        mayContain( std::string_view key ) const noexcept;                     // false means key was definitely never inserted
+      std::size_t bytes     (                      ) const noexcept;                     // size of the filter itself
+
+
+    private:
+      struct alignas( 64 ) Block { std::uint64_t words[8] = {}; };
+
+      std::vector<Block> _blocks;
+  };
+}  // namespace Utilities
@@ -67,6 +67,9 @@ BookDatabase::BookDatabase( const std::string & filename )
 
   /////////////////////// END-TO-DO (2) ////////////////////////////
 
+  isbnFilter = Utilities::BloomFilter( books.size() );
+  for( const auto & book : books ) isbnFilter.insert( book.isbn() );
+
   // Note:  The file is intentionally not explicitly closed.  The file is closed when fin goes out of scope - for whatever
   //        reason.  More precisely, the object named "fin" is destroyed when it goes out of scope and the file is closed in the
   //        destructor. See RAII
@@ -95,6 +98,8 @@ BookDatabase::BookDatabase( const std::string & filename )
 // well.
 
 Book* BookDatabase::find(const std::string& isbn) {
+  // Most ISBNs that aren't in the database are ruled out after reading one cache line, instead of searching every book for them
+  if (!isbnFilter.mayContain(isbn)) return nullptr;
   return find_rec(isbn, books.begin());
 }
 
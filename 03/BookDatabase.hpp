@@ -7,6 +7,7 @@
   /// Do not put anything else in this section, i.e. comments, classes, functions, etc.  Only #include directives
 
 #include <vector>
+#include "BloomFilter.hpp"
 #include "Book.hpp"
 
 /////////////////////// END-TO-DO (1) ////////////////////////////
@@ -37,6 +38,7 @@ class BookDatabase
 
     Book* find_rec(const std::string& isbn, auto iter);
     std::vector<Book> books = {};
+    Utilities::BloomFilter isbnFilter;                                          // Every ISBN in books, to skip searching for ones that aren't
 
     /////////////////////// END-TO-DO (2) ////////////////////////////
 };
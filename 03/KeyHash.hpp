@@ -0,0 +1,59 @@
+/***********************************************************************************************************************************
+** Function keyHash - A fast, well mixed 64-bit hash of a short string such as an ISBN, for the catalog's indexes and filters
+**
+**      auto h = Utilities::keyHash( "0001034359" );         // the same value every run, on every machine of the same endianness
+**      auto g = Utilities::keyHash( "0001034359", 7 );      // a different, independent looking, hash
+**
+**  Unlike std::hash, the result is stable across runs and builds, so it can be saved to a file along with whatever was built from
+**  it.  mix64() (MurmurHash3's finalizer) turns one hash into others, e.g. one per level of a table.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <cstring>      // memcpy()
+#include <string_view>
+
+
+
+
+
+namespace Utilities
+{
+  constexpr std::uint64_t mix64( std::uint64_t x ) noexcept
+  {
+    x ^= x >> 33;   x *= 0xFF51'AFD7'ED55'8CCDULL;
+    x ^= x >> 33;   x *= 0xC4CE'B9FE'1A85'EC53ULL;
+    x ^= x >> 33;
+    return x;
+  }
+
+
+
+  inline std::uint64_t keyHash( std::string_view key, std::uint64_t seed = 0 ) noexcept
+  {
+    std::uint64_t hash = mix64( seed ^ ( key.size() * 0x9E37'79B9'7F4A'7C15ULL ) );
+    std::size_t   i    = 0;
+
+    for( ; i + 8 <= key.size(); i += 8 )
+    {
+      std::uint64_t word;
+      std::memcpy( &word, key.data() + i, 8 );
+      hash = mix64( hash ^ word );
+    }
+
+    std::uint64_t tail = 0;
+    std::memcpy( &tail, key.data() + i, key.size() - i );
+    return mix64( hash ^ tail );
+  }
+
+
+
+  // Maps a hash uniformly onto [0, range) with a multiply rather than a divide (Lemire's "fast range")
+  __extension__ using UInt128 = unsigned __int128;                            // GCC and Clang both have it, __extension__ quiets -pedantic
+
+  constexpr std::size_t fastRange( std::uint64_t hash, std::size_t range ) noexcept
+  {
+    return static_cast<std::size_t>( ( static_cast<UInt128>( hash ) * range ) >> 64 );
+  }
+}  // namespace Utilities
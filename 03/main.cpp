@@ -1,12 +1,17 @@
+#include <array>
+#include <bit>         // countr_zero()
 #include <cmath>       // abs()
-#include <cstddef>     // size_t
+#include <cstddef>     // size_t, ptrdiff_t
+#include <cstdint>     // uint64_t
 #include <iomanip>     // setprecision(), setw()
 #include <iostream>    // cerr, ,clog, fixed(), showpoint(), left(), right()
-#include <map>
+#include <iterator>    // forward_iterator_tag, input_iterator_tag
 #include <queue>
 #include <stack>
-#include <stdexcept>   // invalid_argument, out_of_range
-#include <string>      // stod()
+#include <stdexcept>   // invalid_argument, out_of_range, length_error
+#include <string>      // stod(), to_string()
+#include <utility>     // move()
+#include <vector>
 
 #include "Book.hpp"
 #include "BookDatabase.hpp"
@@ -15,37 +20,32 @@
 
 namespace
 {
+  // The three carts, numbered.  Each holds pointers to the Books on it, bottom first, so moving a Book moves only its pointer.
+  enum CartName : std::size_t { BROKEN_CART, WORKING_CART, SPARE_CART };
+  using Carts = std::array<std::vector<Book *>, 3>;
+
+
+
   // Output some observed behavior.
-  // Call this function from within the carefully_move_books functions, just before kicking off the recursion and then just after each move.
+  // Call this function from within the carefully_move_books functions, just before the first move and then just after each move.
 
   // trace()
-  void trace( std::stack<Book> const & sourceCart, std::stack<Book> const & destinationCart, std::stack<Book> const & spareCart, std::ostream & s = std::clog )
+  void trace( Carts const & carts, std::ostream & s = std::clog )
   {
     // Count and label the number of moves
     static std::size_t move_number = 0;
 
-    // First time called will bind parameters to copies
-    static std::map<std::stack<Book> const *, std::stack<Book>> bookCarts = { { &sourceCart, {}            }, { &destinationCart, {}             }, { &spareCart, {}           } };
-    static std::map<std::stack<Book> const *, std::string>      colLabels = { { &sourceCart, "Broken Cart" }, { &destinationCart, "Working Cart" }, { &spareCart, "Spare Cart" } };
-
-    // Interrogating the stacks is a destructive process, so local copies of the parameters are made to work with.  The
-    // carefully_move_books algorithm will swap the order of the arguments passed to this functions, but they will always be the
-    // same objects - just in different orders. When outputting the stack contents, keep the original order so we humans can trace
-    // the movements easier.  A container (std::map) indexed by the object's identity (address) is created so the canonical order
-    // remains the same from one invocation to the next.
-    bookCarts[&sourceCart]      = sourceCart;
-    bookCarts[&destinationCart] = destinationCart;
-    bookCarts[&spareCart]       = spareCart;
+    static constexpr std::array<char const *, 3> colLabels = { "Broken Cart", "Working Cart", "Spare Cart" };
 
 
     // Determine the height of the tallest stack
     std::size_t tallestStackSize = 0;
-    for( auto & [index, cart] : bookCarts )   if( cart.size() > tallestStackSize )   tallestStackSize = cart.size();
+    for( auto & cart : carts )   if( cart.size() > tallestStackSize )   tallestStackSize = cart.size();
 
 
     // Print the header
     s << "After " << std::setw( 3 ) << move_number++ << " moves:     " << std::left;      // print the move number
-    for( auto & [index, label] : colLabels )    s << std::setw( 23 ) << label;            // print the column labels
+    for( auto label : colLabels )    s << std::setw( 23 ) << label;                       // print the column labels
     s << std::right << "\n                     " << std::string( 23*3, '-' ) << '\n';     // underline the labels
 
 
@@ -54,14 +54,13 @@ namespace
     {
       s << std::string( 21, ' ' );
 
-      for( auto & [key, cart] : bookCarts )                                               // for each book cart
+      for( auto & cart : carts )                                                          // for each book cart
       {
-        if( cart.size() == tallestStackSize )
+        if( cart.size() >= tallestStackSize )
         {
-          auto title = cart.top().title();
+          auto title = cart[tallestStackSize - 1]->title();
           if( title.size() > 20 ) title[17] = title[18] = title[19] = '.';                // replace last few characters of long titles with "..."
           s << std::left << std::setw( 23 ) << title.substr( 0, 20 ) << std::right;
-          cart.pop();
         }
         else
         {
@@ -75,7 +74,7 @@ namespace
 
 
 
-  // carefully_move_books() - recursive
+  // CartMoves - the moves that carefully move books, computed as they're needed
   /*********************************************************************************************************************************
   ** A recursive algorithm to carefully move books from a broken cart to a working cart is given as follows:
   ** START
@@ -97,25 +96,80 @@ namespace
   ** STOP
   **
   ** As a side note, the efficiency class of this algorithm is exponential.  That is, the Big-O is O(2^n).
+  **
+  ** The moves it makes follow a binary counter, so each can be computed from its number alone, without recursion or any record of
+  ** the moves before it.  Counting moves from 1, move i takes book countr_zero(i) (0 is the lightest, on top), from cart
+  ** (i & (i-1)) % 3 to cart ((i | (i-1)) + 1) % 3, where carts 0, 1, 2 are the broken cart then, for an odd number of books, the
+  ** spare and working carts, or, for an even number, the working and spare carts.  There are still 2^n - 1 of them.
   *********************************************************************************************************************************/
-  void carefully_move_books( std::size_t quantity, std::stack<Book> & broken_cart, std::stack<Book> & working_cart, std::stack<Book> & spare_cart )
+  struct CartMove
+  {
+    std::size_t book = 0;                                                                 // 0 is the lightest
+    CartName    from = BROKEN_CART;
+    CartName    to   = WORKING_CART;
+  };
+
+  // A lazy sequence of the moves, like a std::generator's, but a move is computed only as an iterator is dereferenced and
+  // iterators can be copied and compared.
+  //     for( CartMove move : CartMoves( 5 ) ) ...
+  class CartMoves
+  {
+    public:
+      class Iterator
+      {
+        public:
+          using iterator_concept  = std::forward_iterator_tag;
+          using iterator_category = std::input_iterator_tag;                              // dereferences to a CartMove, not a CartMove &
+          using value_type        = CartMove;
+          using difference_type   = std::ptrdiff_t;
+          using reference         = CartMove;
+
+          Iterator() = default;
+          Iterator( std::uint64_t move, std::array<CartName, 3> const & carts ) noexcept : _move( move ), _carts( carts ) {}
+
+          CartMove   operator* (                        ) const noexcept
+          {
+            return { static_cast<std::size_t>( std::countr_zero( _move ) ), _carts[( _move & ( _move - 1 ) ) % 3], _carts[( ( _move | ( _move - 1 ) ) + 1 ) % 3] };
+          }
+
+          Iterator & operator++(                        )       noexcept { ++_move;  return *this; }
+          Iterator   operator++( int                    )       noexcept { auto before = *this;  ++_move;  return before; }
+          bool       operator==( Iterator const & other ) const noexcept { return _move == other._move; }
+
+        private:
+          std::uint64_t           _move  = 1;                                             // counted from 1
+          std::array<CartName, 3> _carts = {};
+      };
+
+      explicit CartMoves( std::size_t quantity )
+        : _quantity( quantity ),
+          _carts( quantity % 2 == 1 ? std::array{ BROKEN_CART, SPARE_CART,   WORKING_CART }
+                                    : std::array{ BROKEN_CART, WORKING_CART, SPARE_CART   } )
+      {
+        if( quantity >= 64 )   throw std::length_error( "Moving " + std::to_string( quantity ) + " books takes more than 2^64 moves" );
+      }
+
+      Iterator      begin() const noexcept { return { 1,                               _carts }; }
+      Iterator      end  () const noexcept { return { std::uint64_t{ 1 } << _quantity, _carts }; }
+      std::uint64_t size () const noexcept { return ( std::uint64_t{ 1 } << _quantity ) - 1; }
+
+    private:
+      std::size_t             _quantity = 0;
+      std::array<CartName, 3> _carts;
+  };
+
+
+
+  // carefully_move_books()
+  void carefully_move_books( Carts & carts, bool traced )
   {
     ///////////////////////// TO-DO (1) //////////////////////////////
       /// Implement the algorithm above.
 
-    auto move_top = [](std::stack<Book>& from, std::stack<Book>& to) {
-      to.push(from.top());
-      from.pop();
-    };
-
-    if (quantity == 1) {
-      move_top(broken_cart, working_cart);
-      trace(broken_cart, working_cart, spare_cart);
-    } else {
-      carefully_move_books(quantity-1, broken_cart, spare_cart, working_cart);
-      move_top(broken_cart, working_cart);
-      trace(broken_cart, working_cart, spare_cart);
-      carefully_move_books(quantity-1, spare_cart, working_cart, broken_cart);
+    for( auto move : CartMoves( carts[BROKEN_CART].size() ) ) {
+      carts[move.to].push_back(carts[move.from].back());
+      carts[move.from].pop_back();
+      if (traced) trace(carts);
     }
 
     /////////////////////// END-TO-DO (1) ////////////////////////////
@@ -124,18 +178,28 @@ namespace
 
 
   // carefully_move_books() - starter
-  void carefully_move_books( std::stack<Book> & from, std::stack<Book> & to )
+  void carefully_move_books( std::stack<Book> & from, std::stack<Book> & to, bool traced = true )
   {
     ///////////////////////// TO-DO (2) //////////////////////////////
       /// Implement the starter function for the above algorithm.  If the "from" cart contains books, move those books to the "to"
       /// cart while ensuring the breakable books are always on top of the nonbreakable books, just like they already are in the
-      /// "from" cart.  That is, call the above carefully_move_books function to start moving books recursively.  Call the above
-      /// trace function just before calling carefully_move_books to get a starting point reference in the movement report.
+      /// "from" cart.  That is, call the above carefully_move_books function to start moving books.  Call the above trace function
+      /// just before calling carefully_move_books to get a starting point reference in the movement report.
+
+    // Take the Books off the broken cart once, lightest first, and move only pointers to them after that.  The carts can hold every
+    // Book from the start, so no move allocates.
+    std::vector<Book> books;
+    books.reserve(from.size());
+    for (; !from.empty(); from.pop()) books.push_back(std::move(from.top()));
+
+    Carts carts;
+    for (auto & cart : carts) cart.reserve(books.size());
+    for (auto book = books.rbegin(); book != books.rend(); ++book) carts[BROKEN_CART].push_back(&*book);
 
-    std::stack<Book> spare;
-    trace(from, to, spare);
+    if (traced) trace(carts);
+    carefully_move_books(carts, traced);
 
-    if (!from.empty()) carefully_move_books(from.size(), from, to, spare);
+    for (auto book : carts[WORKING_CART]) to.push(std::move(*book));
 
     /////////////////////// END-TO-DO (2) ////////////////////////////
   }
@@ -0,0 +1,64 @@
+#include <algorithm>    // max()
+#include <cmath>        // ceil()
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <string_view>
+
+#include "BloomFilter.hpp"
+#include "KeyHash.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  // The bit to set or test in word i of a key's block, taken from a hash independent of the one that chose the block
+  constexpr std::uint64_t bitFor( std::uint64_t hash, std::size_t i ) noexcept
+  { return 1ULL << ( hash >> ( 6 * i ) & 63 ); }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Utilities
+{
+  BloomFilter::BloomFilter( std::size_t expectedKeys, double bitsPerKey )
+    : _blocks( std::max<std::size_t>( 1, static_cast<std::size_t>( std::ceil( static_cast<double>( expectedKeys ) * bitsPerKey / 512.0 ) ) ) )
+  {}
+
+
+
+  void BloomFilter::insert( std::string_view key ) noexcept
+  {
+    auto   hash  = keyHash( key );
+    auto   bits  = mix64( hash );
+    auto & block = _blocks[fastRange( hash, _blocks.size() )];
+
+    for( std::size_t i = 0; i < 8; ++i ) block.words[i] |= bitFor( bits, i );
+  }
+
+
+
+  bool BloomFilter::mayContain( std::string_view key ) const noexcept
+  {
+    auto   hash  = keyHash( key );
+    auto   bits  = mix64( hash );
+    auto & block = _blocks[fastRange( hash, _blocks.size() )];
+
+    // All eight words are tested rather than stopping at the first clear bit:  they're in the same cache line anyway, and this way
+    // there's no branch to mispredict
+    std::uint64_t missing = 0;
+    for( std::size_t i = 0; i < 8; ++i ) missing |= ~block.words[i] & bitFor( bits, i );
+    return missing == 0;
+  }
+
+
+
+  std::size_t BloomFilter::bytes() const noexcept
+  { return _blocks.size() * sizeof( Block ); }
+}  // namespace Utilities
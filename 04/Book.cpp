@@ -1,49 +1,11 @@
-#include <cmath>                                                      // abs(), pow()
 #include <compare>                                                    // weak_ordering
 #include <iomanip>                                                    // quoted()
 #include <iostream>
 #include <string>
-#include <type_traits>                                                // is_floating_point_v, common_type_t
 #include <utility>                                                    // move()
 
 #include "Book.hpp"
-
-
-
-/*******************************************************************************
-**  Implementation of non-member private types, objects, and functions
-*******************************************************************************/
-namespace    // unnamed, anonymous namespace
-{
-  // Avoid direct equality comparisons on floating point numbers. Two values are equal if they are "close enough", which is
-  // represented by Epsilon.  Usually, this is a pretty small number, but since we are dealing with money (only two, maybe three
-  // decimal places) we can be a bit more tolerant.  Two floating point values are considered equal if they are within EPSILON of
-  // each other.
-  template< typename T,  typename U >   requires std::is_floating_point_v<std::common_type_t<T, U> >
-  constexpr bool floating_point_is_equal( T const lhs,  U const rhs,  double const EPSILON = 1e-4 ) noexcept
-  {
-    ///////////////////////// TO-DO (1) //////////////////////////////
-      ///  Write the lines of code that compare two floating point numbers.  Return true when the left hand side (lhs) and the right
-      ///  hand side (rhs) are within Epsilon, and false otherwise.
-      ///
-      ///  See: "Floating point equality" in https://www.learncpp.com/cpp-tutorial/relational-operators-and-floating-point-comparisons/
-      ///
-      ///  Hint:  Avoid writing code that looks like this:
-      ///           if( some expression that is true ) return the constant "true"
-      ///           else                               return the constant "false"
-      ///         for example, avoid:
-      ///           if (a < b) return true;
-      ///           else       return false;
-      ///         do this instead:
-      ///           return a < b
-    return std::fabs( lhs - rhs ) < EPSILON;
-    /////////////////////// END-TO-DO (1) ////////////////////////////
-  }
-}    // unnamed, anonymous namespace
-
-
-
-
+#include "Money.hpp"
 
 
 
@@ -52,7 +14,7 @@ namespace    // unnamed, anonymous namespace
 *******************************************************************************/
 
 // Default and Conversion Constructor
-Book::Book( std::string title,  std::string author,  std::string isbn,  double price )
+Book::Book( std::string title,  std::string author,  std::string isbn,  Money price )
 ///////////////////////// TO-DO (2) //////////////////////////////
   : _isbn( std::move( isbn ) ),
     _title( std::move( title ) ),
@@ -149,7 +111,7 @@ std::string const & Book::author() const &
 
 
 // price() const
-double Book::price() const &
+Money Book::price() const &
 {
   ///////////////////////// TO-DO (11) //////////////////////////////
   return _price;
@@ -237,7 +199,7 @@ Book & Book::author( std::string newAuthor ) &
 
 
 // price()
-Book & Book::price( double newPrice ) &
+Book & Book::price( Money newPrice ) &
 {
   ///////////////////////// TO-DO (18) //////////////////////////////
   _price = newPrice;
@@ -262,37 +224,29 @@ std::weak_ordering Book::operator<=>( const Book & rhs ) const noexcept
   // Design decision:  A very simple and convenient defaulted 3-way comparison operator
   //                         auto operator<=>( const Book & ) const = default;
   //                   in the class definition (header file) would get very close to what is needed and would allow both the <=> and
-  //                   the == operators defined here to be skipped.  The physical ordering of the attributes in the class definition
-  //                   would have to be changed (easy enough in this case) but the default directly compares floating point types
-  //                   (price) for equality, and that should be avoided, in general. For example, if x and y are of type double,
-  //                   then x < y is okay but x == y is not.  So these (operator<=> and operator==) explicit definitions are
-  //                   provided.
+  //                   the == operators defined here to be skipped.  But the physical ordering of the attributes in the class
+  //                   definition would have to match the order Books are sorted in, so these (operator<=> and operator==) explicit
+  //                   definitions are provided.
   //
-  //                   Also, many ordering (sorting) algorithms, like those used in std::map and std::set, require at least a weak
-  //                   ordering of elements. operator<=> provides only a partial ordering when comparing floating point numbers.
+  //                   Price is Money, a whole number of cents, so it compares exactly like any integer.  (A floating point price
+  //                   would have needed an epsilon, and would have given only a partial ordering.)
   //
-  // Weak order:       Objects that compare equal but are not substitutable (identical).  For example, since _price can be within
-  //                   EPSILON, Book("Title", "Author", "ISBN", 9.99999) and Book("Title", "Author", "ISBN", 10.00001) are equal but
-  //                   they are not identical.  If you ignore case when comparing strings, as another example, Book("Title") and
-  //                   Book("title") are equal but they are not identical.
+  // Weak order:       Objects that compare equal but are not substitutable (identical).  If you ignore case when comparing strings,
+  //                   for example, Book("Title") and Book("title") are equal but they are not identical.
   //
   // See std::weak_ordering    at https://en.cppreference.com/w/cpp/utility/compare/weak_ordering and
-  //     std::partial_ordering at https://en.cppreference.com/w/cpp/utility/compare/partial_ordering
   //     The Three-Way Comparison Operator at  http://modernescpp.com/index.php/c-20-the-three-way-comparison-operator
   //     Spaceship (Three way comparison) Operator Demystified https://youtu.be/S9ShnAFmiWM 
   //
   //
-  // Books are equal if all attributes are equal (or within Epsilon for floating point numbers, like price). Books are ordered
-  // (sorted) by ISBN, author, title, then price.
+  // Books are equal if all attributes are equal. Books are ordered (sorted) by ISBN, author, title, then price.
 
   ///////////////////////// TO-DO (19) //////////////////////////////
   if( auto result = ( _isbn <=> rhs._isbn ); result != 0 ) return result;
   if( auto result = ( _author <=> rhs._author ); result != 0 ) return result;
   if( auto result = ( _title <=> rhs._title ); result != 0 ) return result;
 
-  if( floating_point_is_equal( _price, rhs._price ) ) return std::weak_ordering::equivalent;
-  if( _price < rhs._price ) return std::weak_ordering::less;
-  return std::weak_ordering::greater;
+  return _price <=> rhs._price;
   /////////////////////// END-TO-DO (19) ////////////////////////////
 }
 
@@ -306,7 +260,7 @@ bool Book::operator==( const Book & rhs ) const noexcept
   // and then the most likely to be different first.
 
   ///////////////////////// TO-DO (20) //////////////////////////////
-  return floating_point_is_equal( _price, rhs._price )
+  return _price == rhs._price
       && _isbn == rhs._isbn
       && _title == rhs._title
       && _author == rhs._author;
@@ -5,13 +5,128 @@
   /// Do not put anything else in this section, i.e. comments, classes, functions, etc.  Only #include directives
 
 #include "BookDatabase.hpp"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include "EytzingerIndex.hpp"
+#include "InvertedIndex.hpp"
+#include "Money.hpp"
+#include "PerfectHashIndex.hpp"
+#include "PriceIndex.hpp"
+#include "StringArena.hpp"
+#include "SymbolTable.hpp"
+#include "TraceTimer.hpp"
 
 /////////////////////// END-TO-DO (1) ////////////////////////////
 
 
 
+namespace    // unnamed, anonymous namespace
+{
+  // Loads the index saved next to the database if it was built for these same ISBNs, otherwise builds it and tries to save it for
+  // next time.  Not being able to save it (a read only directory, say) only means building it again next time.
+  Utilities::PerfectHashIndex indexOf( std::vector<std::string_view> const & isbns, std::filesystem::path const & savedIndex )
+  {
+    if( std::ifstream saved{ savedIndex, std::ios::binary };  saved )
+    {
+      try { return { isbns, saved }; }
+      catch( Utilities::PerfectHashIndex::Format_Ex const & ) { /* stale or damaged, build a new one */ }
+    }
+
+    TRACE_SCOPE( "BookDatabase index build" );
+    Utilities::PerfectHashIndex index( isbns );
+
+    auto            temporary = std::filesystem::path( savedIndex ) += ".tmp";
+    std::error_code ignored;
+    if( std::ofstream fout{ temporary, std::ios::binary };  fout )
+    {
+      index.save( fout );
+      fout.close();
+      if( fout ) std::filesystem::rename( temporary, savedIndex, ignored );
+    }
+    std::filesystem::remove( temporary, ignored );
+
+    return index;
+  }
+
+
+
+  // Money as a price index holds it, clamped to its range
+  Utilities::PriceIndex::Cents toCents( Money money ) noexcept
+  {
+    using Limits = std::numeric_limits<Utilities::PriceIndex::Cents>;
+    return static_cast<Utilities::PriceIndex::Cents>( std::clamp<Money::Cents>( money.cents(), Limits::min(), Limits::max() ) );
+  }
+
+
+
+  // ISBNs are 10 or 13 digits, the last maybe an X, so each character packs into 4 bits, the first in the highest:  0 past the end,
+  // 1 - 10 for '0' - '9', then 11 for 'X' and 12 for 'x'.  Packed ISBNs order as their text does.  Anything else is kept in the
+  // string arena instead, its offset tagged with SPILLED in the top 4 bits, which no packed ISBN starts with.
+  constexpr std::string_view ISBN_CHARACTERS = "0123456789Xx";
+  constexpr std::uint64_t    SPILLED         = std::uint64_t{ 0xF } << 60;
+
+  std::optional<std::uint64_t> packIsbn( std::string_view isbn ) noexcept
+  {
+    if( isbn.size() > 16 )   return std::nullopt;
+
+    std::uint64_t packed = 0;
+    for( std::size_t i = 0; i < 16; ++i )
+    {
+      std::uint64_t code = 0;
+      if( i < isbn.size() )
+      {
+        auto c = isbn[i];
+        if     ( c >= '0'  &&  c <= '9' )   code = static_cast<std::uint64_t>( c - '0' ) + 1;
+        else if( c == 'X'               )   code = 11;
+        else if( c == 'x'               )   code = 12;
+        else                                return std::nullopt;
+      }
+      packed = packed << 4 | code;
+    }
+    return packed;
+  }
+
+
+
+  std::string unpackIsbn( std::uint64_t packed )
+  {
+    std::string isbn;
+    for( int shift = 60; shift >= 0; shift -= 4 )
+    {
+      auto code = packed >> shift & 0xF;
+      if( code == 0 )   break;
+      isbn += ISBN_CHARACTERS[code - 1];
+    }
+    return isbn;
+  }
+
+
+
+  constexpr bool isSpilled( std::uint64_t isbn ) noexcept
+  { return ( isbn & SPILLED ) == SPILLED; }
+
+
+
+  // A symbol table learns about as well from a sample of titles as from all of them, and far faster
+  constexpr std::size_t SYMBOL_SAMPLE_BYTES = 64 * 1024;
+}    // unnamed, anonymous namespace
+
+
+
+
 // Return a reference to the one and only instance of the database
 BookDatabase & BookDatabase::instance()
 {
@@ -36,6 +151,7 @@ BookDatabase & BookDatabase::instance()
 // Construction
 BookDatabase::BookDatabase( const std::string & filename )
 {
+  TRACE_SCOPE( "BookDatabase load" );
   std::ifstream fin( filename, std::ios::binary );
 
   // The file contains Books separated by whitespace.  A Book has 4 pieces of data delimited with a comma.  (This exactly matches
@@ -61,11 +177,50 @@ BookDatabase::BookDatabase( const std::string & filename )
 
   Book tmp;
   while (fin >> tmp) {
-    _data[tmp.isbn()] = tmp;
+    _records.push_back(recordOf(tmp));
   }
 
   /////////////////////// END-TO-DO (2) ////////////////////////////
 
+  // The catalog never changes once it's loaded, so rather than a general purpose search tree, ISBNs are indexed with a minimal
+  // perfect hash and the Books are stored in the index's slot order.  A lookup hashes the ISBN straight to its Book.
+  //
+  // Of Books sharing an ISBN, the last one read is kept (as assigning each into a map would have).  The others' strings are left
+  // behind in _strings when arrangeBy() copies the rest.
+  auto byIsbn = [this]( Record const & lhs, Record const & rhs ) { return isbnLess( lhs, rhs ); };
+  std::stable_sort( _records.begin(), _records.end(), byIsbn );
+  auto kept = std::unique( _records.rbegin(), _records.rend(), [&]( Record const & lhs, Record const & rhs ) { return !byIsbn( lhs, rhs )  &&  !byIsbn( rhs, lhs ); } );
+  _records.erase( _records.begin(), kept.base() );
+
+  if( !_records.empty() )
+  {
+    std::string isbnText;
+    _isbnIndex = indexOf( isbns( isbnText ), std::filesystem::path( filename ).replace_extension( ".mph" ) );   // saved next to the database
+    arrangeBy( [this]( std::string_view isbn ) noexcept { return _isbnIndex.find( isbn ); } );
+
+    // The author and title indexes don't depend on each other, so the titles are indexed on a second thread while this one indexes
+    // the authors
+    auto indexOfField = [this]( Utilities::StringArena::Offset Record::* field )
+    {
+      TRACE_SCOPE( "BookDatabase secondary index build" );
+      std::vector<std::string_view> terms;
+      terms.reserve( _records.size() );
+      for( auto const & record : _records ) terms.push_back( _strings.at( record.*field ) );
+      return Utilities::InvertedIndex( terms );
+    };
+
+    auto titles  = std::async( std::launch::async, indexOfField, &Record::title );
+    _authorIndex = indexOfField( &Record::author );
+
+    // Prices are grouped by their author's term id.  Ids are in name order, so the authors starting with any prefix are one range.
+    std::vector<Utilities::PriceIndex::Cents> prices;
+    prices.reserve( _records.size() );
+    for( auto const & record : _records ) prices.push_back( toCents( record.price ) );
+    _priceIndex = Utilities::PriceIndex( std::move( prices ), _authorIndex.termIds() );
+
+    _titleIndex  = titles.get();
+  }
+
   // Note:  The file is intentionally not explicitly closed.  The file is closed when fin goes out of scope - for whatever
   //        reason.  More precisely, the object named "fin" is destroyed when it goes out of scope and the file is closed in the
   //        destructor. See RAII
@@ -86,14 +241,436 @@ BookDatabase::BookDatabase( const std::string & filename )
   /// assignment, implement BookDatabase::find() as a binary search (an O(log n) operation) by delegating to the std::map's binary
   /// search function find().
 
-Book* BookDatabase::find(const std::string& isbn) {
-  auto book = _data.find(isbn);
-  if (book == _data.end()) {
+BookDatabase::BookPointer BookDatabase::find(std::string_view isbn) {
+  // The perfect hash rejects nearly every ISBN not in the catalog by itself, but not all, so confirm the match.  Either index's
+  // NOT_FOUND is past the end of _records.
+  auto slot = Utilities::PerfectHashIndex::NOT_FOUND;
+  if (_indexKind == Index::PerfectHash) {
+    slot = _isbnIndex.find(isbn);
+  } else if (auto key = Utilities::packKey(isbn)) {
+    slot = _sortedIsbnIndex.find(*key);
+  }
+
+  if (slot >= _records.size()) {
+    return nullptr;
+  }
+
+  // Confirming a packed ISBN is one integer comparison
+  auto const & record = _records[slot];
+  auto         packed = packIsbn(isbn);
+  if (packed ? record.isbn != *packed : !isSpilled(record.isbn) || isbnOf(record) != isbn) {
     return nullptr;
   }
-  return &book->second;
+  return {*this, slot};
 }
 
-std::size_t BookDatabase::size() const { return _data.size(); }
+std::size_t BookDatabase::size() const { return _records.size(); }
 
 /////////////////////// END-TO-DO (3) ////////////////////////////
+
+
+
+
+
+
+
+
+
+BookDatabase::Matches BookDatabase::findByAuthor( std::string_view author )
+{ return { _authorIndex.find( author ), this }; }
+
+
+
+BookDatabase::Matches BookDatabase::findByTitle( std::string_view title )
+{ return { _titleIndex.find( title ), this }; }
+
+
+
+std::vector<BookDatabase::Matches> BookDatabase::completeTitle( std::string_view prefix, std::size_t count )
+{
+  std::vector<Matches> completions;
+  for( auto positions : _titleIndex.complete( prefix, count ) ) completions.emplace_back( positions, this );
+  return completions;
+}
+
+
+
+std::vector<BookDatabase::Matches> BookDatabase::findFuzzyTitle( std::string_view title, std::size_t maxEdits, std::size_t count )
+{
+  _titleIndex.indexGrams();
+
+  std::vector<Matches> matches;
+  for( auto positions : _titleIndex.fuzzyFind( title, maxEdits, count ) ) matches.emplace_back( positions, this );
+  return matches;
+}
+
+
+
+std::vector<BookDatabase::Matches> BookDatabase::findFuzzyAuthor( std::string_view author, std::size_t maxEdits, std::size_t count )
+{
+  _authorIndex.indexGrams();
+
+  std::vector<Matches> matches;
+  for( auto positions : _authorIndex.fuzzyFind( author, maxEdits, count ) ) matches.emplace_back( positions, this );
+  return matches;
+}
+
+
+
+BookDatabase::PriceSummary BookDatabase::priceSummary( Money low, Money high )
+{
+  auto summary = _priceIndex.summarize( toCents( low ), toCents( high ) );
+  return { summary.count, Money::fromCents( summary.total ) };
+}
+
+
+
+BookDatabase::PriceSummary BookDatabase::priceSummary( Money low, Money high, std::string_view authorPrefix )
+{
+  auto [first, last] = _authorIndex.prefixIds( authorPrefix );
+  auto summary       = _priceIndex.summarize( toCents( low ), toCents( high ),
+                                              static_cast<Utilities::PriceIndex::Group>( first ), static_cast<Utilities::PriceIndex::Group>( last ) );
+  return { summary.count, Money::fromCents( summary.total ) };
+}
+
+
+
+BookDatabase::Matches BookDatabase::pricedBetween( Money low, Money high )
+{ return { _priceIndex.pricedBetween( toCents( low ), toCents( high ) ), this }; }
+
+
+
+std::size_t BookDatabase::catalogBytes() const noexcept
+{
+  auto bytes = _records.capacity() * sizeof( Record ) + _strings.bytes();
+  if( _storageKind == Storage::Compressed )   bytes += _authors.bytes() + _titleSymbols.bytes();
+  return bytes;
+}
+
+
+
+std::size_t BookDatabase::secondaryIndexBytes() const noexcept
+{ return _authorIndex.bytes() + _titleIndex.bytes() + _priceIndex.bytes(); }
+
+
+
+
+BookDatabase::Index BookDatabase::index() const noexcept
+{ return _indexKind; }
+
+
+
+
+void BookDatabase::useIndex( Index kind )
+{
+  if( kind == _indexKind )   return;
+
+  if( kind == Index::Eytzinger )
+  {
+    std::vector<Utilities::PackedKey> keys;
+    keys.reserve( _records.size() );
+    for( auto const & record : _records )
+    {
+      auto isbn = isbnOf( record );
+      auto key  = Utilities::packKey( isbn );
+      if( !key )   throw std::length_error( "ISBN \"" + isbn + "\" is too long for the sorted index" );
+      keys.push_back( *key );
+    }
+
+    _sortedIsbnIndex = Utilities::EytzingerIndex<Utilities::PackedKey>( std::move( keys ) );
+    arrangeBy( [this]( std::string_view isbn ) noexcept { return _sortedIsbnIndex.find( *Utilities::packKey( isbn ) ); } );
+    _isbnIndex = {};
+  }
+  else
+  {
+    std::string isbnText;
+    _isbnIndex = Utilities::PerfectHashIndex( isbns( isbnText ) );
+    arrangeBy( [this]( std::string_view isbn ) noexcept { return _isbnIndex.find( isbn ); } );
+    _sortedIsbnIndex = {};
+  }
+
+  _indexKind = kind;
+}
+
+
+
+
+BookDatabase::Storage BookDatabase::storage() const noexcept
+{ return _storageKind; }
+
+
+
+
+void BookDatabase::useStorage( Storage kind )
+{
+  if( kind == _storageKind )   return;
+
+  // Every string is copied into new arenas as the new storage keeps it, leaving behind, as arrangeBy() does, those no Book uses
+  Utilities::StringArena strings, authors;
+  strings.reserve( _strings.bytes() );
+
+  if( kind == Storage::Compressed )
+  {
+    // Learn the symbols from titles spread across the whole catalog
+    std::size_t totalBytes = 0;
+    for( auto const & record : _records ) totalBytes += _strings.at( record.title ).size();
+
+    std::vector<std::string_view> sample;
+    auto stride = std::max<std::size_t>( 1, totalBytes / SYMBOL_SAMPLE_BYTES );
+    for( std::size_t i = 0; i < _records.size(); i += stride ) sample.push_back( _strings.at( _records[i].title ) );
+    _titleSymbols = Utilities::SymbolTable( sample );
+
+    // Authors are looked up by their text in the old arena, which outlives the map
+    std::unordered_map<std::string_view, Utilities::StringArena::Offset> authorOffsets;
+    for( auto & record : _records )
+    {
+      if( isSpilled( record.isbn ) )   record.isbn = SPILLED | strings.append( _strings.at( static_cast<Utilities::StringArena::Offset>( record.isbn ) ) );
+      record.title = strings.append( _titleSymbols.encode( _strings.at( record.title ) ) );
+
+      auto author           = _strings.at( record.author );
+      auto [where, isFirst] = authorOffsets.try_emplace( author );
+      if( isFirst ) where->second = authors.append( author );
+      record.author = where->second;
+    }
+  }
+  else
+  {
+    for( auto & record : _records )
+    {
+      if( isSpilled( record.isbn ) )   record.isbn = SPILLED | strings.append( _strings.at( static_cast<Utilities::StringArena::Offset>( record.isbn ) ) );
+      record.title  = strings.append( _titleSymbols.decode( _strings.at( record.title ) ) );
+      record.author = strings.append( _authors.at( record.author ) );
+    }
+    _titleSymbols = {};
+  }
+
+  strings.shrinkToFit();
+  authors.shrinkToFit();
+  _strings     = std::move( strings );
+  _authors     = std::move( authors );
+  _storageKind = kind;
+}
+
+
+
+
+void BookDatabase::arrangeBy( std::function<std::size_t( std::string_view )> const & slotOf )
+{
+  std::vector<Record>                            arranged    ( _records.size() );
+  std::vector<Utilities::InvertedIndex::Posting> newPositions( _records.size() );
+  for( std::size_t i = 0; i < _records.size(); ++i )
+  {
+    auto slot       = slotOf( isbnOf( _records[i] ) );
+    newPositions[i] = static_cast<Utilities::InvertedIndex::Posting>( slot );
+    arranged[slot]  = _records[i];
+  }
+
+  // The strings follow their Books into a new arena, leaving behind those no Book uses any more:  of duplicate ISBNs dropped, and of
+  // titles and authors since changed.  Titles are copied as stored, encoded or not.  Compressed authors are shared, so they stay
+  // where they are.
+  Utilities::StringArena strings;
+  strings.reserve( _strings.bytes() );
+  for( auto & record : arranged )
+  {
+    if( isSpilled( record.isbn ) )   record.isbn = SPILLED | strings.append( _strings.at( static_cast<Utilities::StringArena::Offset>( record.isbn ) ) );
+    record.title = strings.append( _strings.at( record.title ) );
+    if( _storageKind == Storage::Raw )   record.author = strings.append( _strings.at( record.author ) );
+  }
+  strings.shrinkToFit();
+
+  _records = std::move( arranged );
+  _strings = std::move( strings );
+
+  // The secondary indexes refer to Books by position, so follow them to their new ones
+  _authorIndex.renumber( newPositions );
+  _titleIndex .renumber( newPositions );
+  _priceIndex .renumber( newPositions );
+}
+
+
+
+
+BookDatabase::Record BookDatabase::recordOf( Book const & book )
+{ return { isbnCode( book.isbn() ), book.price(), storeTitle( book.title() ), storeAuthor( book.author() ) }; }
+
+
+
+std::uint64_t BookDatabase::isbnCode( std::string_view isbn )
+{
+  if( auto packed = packIsbn( isbn ) )   return *packed;
+  return SPILLED | _strings.append( isbn );
+}
+
+
+
+std::string BookDatabase::isbnOf( Record const & record ) const
+{
+  if( isSpilled( record.isbn ) )   return std::string( _strings.at( static_cast<Utilities::StringArena::Offset>( record.isbn ) ) );
+  return unpackIsbn( record.isbn );
+}
+
+
+
+bool BookDatabase::isbnLess( Record const & lhs, Record const & rhs ) const
+{
+  if( !isSpilled( lhs.isbn )  &&  !isSpilled( rhs.isbn ) )   return lhs.isbn < rhs.isbn;
+  return isbnOf( lhs ) < isbnOf( rhs );
+}
+
+
+
+Utilities::StringArena::Offset BookDatabase::storeTitle( std::string_view title )
+{
+  if( _storageKind == Storage::Compressed )   return _strings.append( _titleSymbols.encode( title ) );
+  return _strings.append( title );
+}
+
+
+
+// A changed author isn't looked for among those already stored, it's simply added.  Only loading stores many authors, and that's
+// always Raw.
+Utilities::StringArena::Offset BookDatabase::storeAuthor( std::string_view author )
+{
+  if( _storageKind == Storage::Compressed )   return _authors.append( author );
+  return _strings.append( author );
+}
+
+
+
+std::string BookDatabase::titleOf( Record const & record ) const
+{
+  if( _storageKind == Storage::Compressed )   return _titleSymbols.decode( _strings.at( record.title ) );
+  return std::string( _strings.at( record.title ) );
+}
+
+
+
+std::string_view BookDatabase::authorOf( Record const & record ) const noexcept
+{
+  if( _storageKind == Storage::Compressed )   return _authors.at( record.author );
+  return _strings.at( record.author );
+}
+
+
+
+std::vector<std::string_view> BookDatabase::isbns( std::string & text ) const
+{
+  // All the text is gathered before any view of it is taken, as appending may move it
+  std::vector<std::size_t> ends;
+  ends.reserve( _records.size() );
+  text.clear();
+  for( auto const & record : _records )
+  {
+    text += isbnOf( record );
+    ends.push_back( text.size() );
+  }
+
+  std::vector<std::string_view> views;
+  views.reserve( ends.size() );
+  for( std::size_t start = 0; auto end : ends )
+  {
+    views.emplace_back( text.data() + start, end - start );
+    start = end;
+  }
+  return views;
+}
+
+
+
+
+
+
+
+
+/*******************************************************************************
+**  BookDatabase::BookView and BookDatabase::BookPointer
+*******************************************************************************/
+
+// The ISBN index maps each ISBN to its position, so a Book given a different ISBN in place could no longer be found by either
+BookDatabase::BookView & BookDatabase::BookView::operator=( Book const & rhs )
+{
+  if( rhs.isbn() != isbn() )   throw std::invalid_argument( "Book \"" + rhs.isbn() + "\" can't replace Book \"" + isbn() + "\" in place, the ISBNs differ" );
+
+  record().title  = _database->storeTitle ( rhs.title()  );
+  record().author = _database->storeAuthor( rhs.author() );
+  record().price  = rhs.price();
+  return *this;
+}
+
+
+
+std::string BookDatabase::BookView::isbn() const
+{ return _database->isbnOf( record() ); }
+
+
+
+std::string BookDatabase::BookView::title() const
+{ return _database->titleOf( record() ); }
+
+
+
+std::string BookDatabase::BookView::author() const
+{ return std::string( _database->authorOf( record() ) ); }
+
+
+
+Money BookDatabase::BookView::price() const noexcept
+{ return record().price; }
+
+
+
+BookDatabase::BookView::operator Book() const
+{ return Book( title(), author(), isbn(), price() ); }
+
+
+
+BookDatabase::BookView & BookDatabase::BookView::title( std::string_view newTitle )
+{
+  record().title = _database->storeTitle( newTitle );
+  return *this;
+}
+
+
+
+BookDatabase::BookView & BookDatabase::BookView::author( std::string_view newAuthor )
+{
+  record().author = _database->storeAuthor( newAuthor );
+  return *this;
+}
+
+
+
+BookDatabase::BookView & BookDatabase::BookView::price( Money newPrice ) noexcept
+{
+  record().price = newPrice;
+  return *this;
+}
+
+
+
+bool BookDatabase::BookView::operator==( BookView const & rhs ) const
+{ return price() == rhs.price()  &&  isbn() == rhs.isbn()  &&  title() == rhs.title()  &&  author() == rhs.author(); }
+
+
+
+bool BookDatabase::BookView::operator==( Book const & rhs ) const
+{ return price() == rhs.price()  &&  isbn() == rhs.isbn()  &&  title() == rhs.title()  &&  author() == rhs.author(); }
+
+
+
+// Written as Book's operator<< writes a Book
+std::ostream & operator<<( std::ostream & stream, BookDatabase::BookView const & book )
+{
+  return stream << std::quoted( book.isbn()   ) << ",  "
+                << std::quoted( book.title()  ) << ",  "
+                << std::quoted( book.author() ) << ",  "
+                << book.price();
+}
+
+
+
+std::ostream & operator<<( std::ostream & stream, BookDatabase::BookPointer const & pointer )
+{
+  if( !pointer )   return stream << "nullptr";
+  return stream << *pointer;
+}
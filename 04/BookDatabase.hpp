@@ -1,10 +1,23 @@
 #pragma once
 
-#include <cstddef>                                                              // size_t
+#include <cstddef>                                                              // size_t, ptrdiff_t, nullptr_t
+#include <cstdint>                                                              // uint64_t
+#include <functional>                                                           // function
+#include <iosfwd>                                                               // ostream
+#include <iterator>                                                             // forward_iterator_tag, input_iterator_tag
+#include <span>
 #include <string>
-#include <map>
+#include <string_view>
+#include <vector>
 
 #include "Book.hpp"
+#include "EytzingerIndex.hpp"
+#include "InvertedIndex.hpp"
+#include "Money.hpp"
+#include "PerfectHashIndex.hpp"
+#include "PriceIndex.hpp"
+#include "StringArena.hpp"
+#include "SymbolTable.hpp"
 
 
 
@@ -12,14 +25,75 @@
 class BookDatabase
 {
   public:
+    class BookView;                                                             // A Book in the database, by reference
+    class BookPointer;                                                          // What find() returns, used like a Book *
+    class Matches;                                                              // The Books a secondary index query found
+
     // Get a reference to the one and only instance of the database
     static BookDatabase & instance();
 
     // Locate and return a reference to a particular record
-    Book * find( const std::string & isbn );                                    // Returns a pointer to the item in the database if
+    BookPointer find( std::string_view isbn );                                  // Returns a pointer to the item in the database if
                                                                                 // found, nullptr otherwise
+    // Locate all the records by an author, or with a title.  Matching ignores case, punctuation, and spacing (see
+    // Utilities::InvertedIndex::normalize()).  The indexes reflect the authors and titles as loaded, not later changes made through
+    // the Books returned.
+    Matches findByAuthor( std::string_view author );
+    Matches findByTitle ( std::string_view title  );
+
+    // Complete a title as it's typed:  the Books of each of the first count titles (alphabetically, as normalized) starting with
+    // prefix.  A prefix ending in a space or punctuation completes only whole words, so "war " completes "War and Peace" but not
+    // "Warlock."
+    std::vector<Matches> completeTitle( std::string_view prefix, std::size_t count = 10 );
+
+    // Forgive typing mistakes:  the Books of each of the count titles (authors) closest to title (author), within maxEdits letters
+    // inserted, deleted, or changed, closest first.  The first call of each builds an index of the titles' (authors') trigrams.
+    std::vector<Matches> findFuzzyTitle ( std::string_view title,  std::size_t maxEdits = 2, std::size_t count = 10 );
+    std::vector<Matches> findFuzzyAuthor( std::string_view author, std::size_t maxEdits = 2, std::size_t count = 10 );
+
+    // Catalog analytics:  how many Books are priced from low through high, and what they cost altogether, of every author or of
+    // only the authors whose names (normalized as above) start with authorPrefix.  Like the other secondary indexes, prices reflect
+    // the Books as loaded.
+    struct PriceSummary
+    {
+      std::size_t count = 0;
+      Money       total;
+    };
+
+    PriceSummary priceSummary ( Money low, Money high                                );
+    PriceSummary priceSummary ( Money low, Money high, std::string_view authorPrefix );
+    Matches      pricedBetween( Money low, Money high                                );   // cheapest first
+
     // Queries
-    std::size_t size() const;                                                   // Returns the number of items in the database
+    std::size_t size               () const;                                    // Returns the number of items in the database
+    std::size_t catalogBytes       () const noexcept;                           // Memory used by the Books themselves, in the current
+                                                                                // storage
+    std::size_t secondaryIndexBytes() const noexcept;                           // Memory used by the author, title, and price
+                                                                                // indexes, trigrams included once built
+
+
+    // How find() locates a Book by ISBN.  Both are built once and never updated, which is all a catalog that doesn't change needs.
+    enum class Index
+    {
+      PerfectHash,                                                              // Hashes straight to the Book (the default)
+      Eytzinger                                                                 // A sorted search tree laid out for the cache
+    };
+
+    Index index   (            ) const noexcept;
+    void  useIndex( Index kind );                                               // Rebuilds the index and rearranges the Books to suit it, so
+                                                                                // pointers and Matches returned before are no longer valid
+
+    // How the Books' titles and authors are stored.  Compressed takes much less memory, but titles are decoded each time they're
+    // read.  ISBNs and prices, all find() and a receipt need, are stored the same either way.
+    enum class Storage
+    {
+      Raw,                                                                      // As read (the default)
+      Compressed                                                                // Each author once, titles encoded with a SymbolTable
+    };
+
+    Storage storage   (              ) const noexcept;
+    void    useStorage( Storage kind );                                         // Re-encodes every title and author, so the views
+                                                                                // returned before are no longer valid
 
   private:
     BookDatabase            ( const std::string  & filename );
@@ -27,5 +101,170 @@ class BookDatabase
     BookDatabase & operator=( const BookDatabase &          ) = delete;         // intentionally prohibit copy assignments
 
     // Private implementation details
-    std::map<std::string /*ISBN*/, Book> _data;                                 // Collection of Books indexed by ISBN
+    //
+    // Books are stored in two parts.  What find() and a receipt need, the ISBN and price, is in a small fixed size Record with the
+    // positions of the title and author, which are stored apart in one string arena.  That's well under half the memory of a
+    // vector of Books, each holding three std::strings, most of them separately allocated.
+    //
+    // Compressed storage goes further.  Authors repeat, so each is stored once, in _authors, and a Record's author is its offset
+    // there.  Titles are too varied for that, but share words and phrases, so they're stored encoded with _titleSymbols.
+    struct Record
+    {
+      std::uint64_t                  isbn   = 0;                                // packed, see packIsbn() in BookDatabase.cpp
+      Money                          price;
+      Utilities::StringArena::Offset title  = 0;                                // in _strings
+      Utilities::StringArena::Offset author = 0;                                // in _strings, or _authors if Compressed
+    };
+
+    Record        recordOf( Book const & book );                                // appends book's strings as stored
+    std::uint64_t isbnCode( std::string_view isbn );                            // packed, or appended to _strings if it can't be
+    std::string   isbnOf  ( Record const & record ) const;
+    bool          isbnLess( Record const & lhs, Record const & rhs ) const;
+
+    Utilities::StringArena::Offset storeTitle ( std::string_view title  );
+    Utilities::StringArena::Offset storeAuthor( std::string_view author );
+    std::string                    titleOf    ( Record const & record ) const;  // decoded, if need be
+    std::string_view               authorOf   ( Record const & record ) const noexcept;
+
+    std::vector<std::string_view> isbns( std::string & text ) const;            // every ISBN in position order, viewing text
+
+    void arrangeBy( std::function<std::size_t( std::string_view )> const & slotOf );   // moves each Book to its ISBN's slot
+
+    Index                                           _indexKind   = Index::PerfectHash;
+    Storage                                         _storageKind = Storage::Raw;
+    std::vector<Record>                             _records;                   // Collection of Books, in the index's slot order,
+    Utilities::StringArena                          _strings;                   // and their titles and authors (and any ISBN too odd to pack)
+    Utilities::StringArena                          _authors;                   // Each author once, if Compressed
+    Utilities::SymbolTable                          _titleSymbols;              // Encodes the titles, if Compressed
+    Utilities::PerfectHashIndex                     _isbnIndex;                 // Minimal perfect hash of ISBN to position in _records,
+    Utilities::EytzingerIndex<Utilities::PackedKey> _sortedIsbnIndex;           // or ISBNs sorted, in Eytzinger order
+    Utilities::InvertedIndex                        _authorIndex;               // Author to positions in _records
+    Utilities::InvertedIndex                        _titleIndex;                // Title  to positions in _records
+    Utilities::PriceIndex                           _priceIndex;                // Price, grouped by author, of each position in _records
+};
+
+
+
+
+// A Book in the database, by reference.  Reading it reads the database and changing it changes the database, as through a Book *;
+// copies refer to the same Book, and it converts to a Book to keep one of its own.  Views are valid only until the database's index
+// or storage is changed.
+//     BookDatabase::BookView book = *BookDatabase::instance().find( "0001062417" );
+//     std::cout << book;  book.price( 59.99 );  Book copy = book;
+class BookDatabase::BookView
+{
+  friend std::ostream & operator<<( std::ostream & stream, BookView const & book );
+
+  public:
+    struct Arrow;                                                               // What operator->() returns, so book->title() works
+
+    BookView( BookDatabase & database, std::size_t position ) noexcept : _database( &database ), _position( position ) {}
+    BookView( BookView const & other ) = default;
+
+    BookView & operator=( BookView const & rhs ) = delete;                      // assign a Book, or copy the pointer to one instead
+    BookView & operator=( Book     const & rhs );                               // replaces the Book's title, author, and price;
+                                                                                // throws std::invalid_argument if rhs's ISBN isn't this Book's
+
+    // Accessors
+    std::string      isbn  () const;
+    std::string      title () const;                                            // a copy, as the title may be stored compressed
+    std::string      author() const;                                            // a copy, as changing any Book may move the stored one
+    Money            price () const noexcept;
+
+    operator Book() const;                                                      // a copy of the Book
+
+    // Modifiers                                                                // The secondary indexes don't follow these changes.  The ISBN
+                                                                                // can't change, as the ISBN index wouldn't find it
+    BookView & title ( std::string_view newTitle  );
+    BookView & author( std::string_view newAuthor );
+    BookView & price ( Money            newPrice  ) noexcept;
+
+    // Relational Operators                                                     // the same Books, as Book's == defines
+    bool operator==( BookView const & rhs ) const;
+    bool operator==( Book     const & rhs ) const;
+
+  private:
+    Record & record() const noexcept { return _database->_records[_position]; }
+
+    BookDatabase * _database = nullptr;
+    std::size_t    _position = 0;
+};
+
+struct BookDatabase::BookView::Arrow
+{
+  BookView view;
+  BookView * operator->() noexcept { return &view; }
+};
+
+
+
+
+// What find() returns:  nullptr, or a pointer to a Book in the database.  It's used like a Book *, but dereferences to a BookView.
+class BookDatabase::BookPointer
+{
+  friend std::ostream & operator<<( std::ostream & stream, BookPointer const & pointer );
+
+  public:
+    BookPointer( std::nullptr_t = nullptr ) noexcept {}
+    BookPointer( BookDatabase & database, std::size_t position ) noexcept : _database( &database ), _position( position ) {}
+
+    BookView        operator* () const noexcept { return {   *_database, _position   }; }
+    BookView::Arrow operator->() const noexcept { return { { *_database, _position } }; }
+
+    explicit operator bool(                           ) const noexcept { return _database != nullptr; }
+    bool     operator==   ( std::nullptr_t            ) const noexcept { return _database == nullptr; }
+    bool     operator==   ( BookPointer const & other ) const noexcept = default;
+
+  private:
+    BookDatabase * _database = nullptr;
+    std::size_t    _position = 0;
+};
+
+
+
+
+// A lightweight view of the Books a query matched, in the query's order.  It owns and copies nothing, and is valid only until the
+// database's index is changed.
+//     for( BookDatabase::BookView book : BookDatabase::instance().findByAuthor( "Rosemary Sullivan" ) ) ...
+class BookDatabase::Matches
+{
+  public:
+    using Position = Utilities::InvertedIndex::Posting;                         // a Book's position in the database
+
+    class Iterator
+    {
+      public:
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;                      // dereferences to a BookView, not a Book &
+        using value_type        = Book;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = BookView::Arrow;
+        using reference         = BookView;
+
+        Iterator() = default;
+        Iterator( const Position * position, BookDatabase * database ) noexcept : _position( position ), _database( database ) {}
+
+        BookView        operator* (                        ) const noexcept { return {   *_database, *_position   }; }
+        BookView::Arrow operator->(                        ) const noexcept { return { { *_database, *_position } }; }
+        Iterator &      operator++(                        )       noexcept { ++_position;  return *this; }
+        Iterator        operator++( int                    )       noexcept { auto before = *this;  ++_position;  return before; }
+        bool            operator==( Iterator const & other ) const noexcept { return _position == other._position; }
+
+      private:
+        const Position * _position = nullptr;
+        BookDatabase   * _database = nullptr;
+    };
+
+    Matches() = default;
+    Matches( std::span<const Position> positions, BookDatabase * database ) noexcept : _positions( positions ), _database( database ) {}
+
+    Iterator    begin     (               ) const noexcept { return { _positions.data(),                     _database }; }
+    Iterator    end       (               ) const noexcept { return { _positions.data() + _positions.size(), _database }; }
+    BookView    operator[]( std::size_t i ) const noexcept { return { *_database, _positions[i] }; }
+    std::size_t size      (               ) const noexcept { return _positions.size(); }
+    bool        empty     (               ) const noexcept { return _positions.empty(); }
+
+  private:
+    std::span<const Position> _positions;
+    BookDatabase *            _database = nullptr;
 };
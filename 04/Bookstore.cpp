@@ -4,9 +4,17 @@
 
 #include "Bookstore.hpp"
 #include "BookDatabase.hpp"
+#include <cstddef>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "BloomFilter.hpp"
+#include "EytzingerIndex.hpp"
+#include "Money.hpp"
+#include "TraceTimer.hpp"
 
 /////////////////////// END-TO-DO (1) ////////////////////////////
 
@@ -45,6 +53,8 @@ Bookstore::Bookstore( const std::string & persistentInventoryDB )
   }
 
   /////////////////////// END-TO-DO (2) ////////////////////////////
+
+  rebuildInventoryFilter();
 }                                                                 // File is closed as fin goes out of scope
 
 
@@ -54,7 +64,45 @@ Bookstore::Bookstore( const std::string & persistentInventoryDB )
 
 
 Bookstore::Inventory_DB & Bookstore::getInventory()
-{ return _inventoryDB; }
+{
+  _inventoryChanged = true;                                       // The caller may add to the inventory before the next batch
+  return _inventoryDB;
+}
+
+
+
+
+Bookstore::InventoryView Bookstore::inventoryView() const
+{ return InventoryView( _inventoryDB ); }
+
+
+
+
+
+
+
+std::size_t Bookstore::inventoryFilterBuilds() const noexcept
+{ return _inventoryFilterBuilds; }
+
+
+
+// The inventory filter is only good as long as nothing's been added to the inventory since it was built.  Within a batch (ringing
+// up all customers, reordering) only this class touches the inventory, and it only ever changes quantities, so the filter is rebuilt
+// at the start of a batch only if the inventory has been handed out since it was last built.
+void Bookstore::rebuildInventoryFilter()
+{
+  _inventoryFilter = Utilities::BloomFilter( _inventoryDB.size() );
+  for( const auto & [isbn, quantity] : _inventoryDB ) _inventoryFilter.insert( isbn );
+  _inventoryChanged = false;
+  ++_inventoryFilterBuilds;
+}
+
+
+
+Bookstore::Inventory_DB::iterator Bookstore::findInInventory( const std::string & isbn )
+{
+  return _inventoryFilter.mayContain( isbn ) ? _inventoryDB.find( isbn ) : _inventoryDB.end();
+}
 
 
 
@@ -64,7 +112,9 @@ Bookstore::Inventory_DB & Bookstore::getInventory()
 
 Bookstore::BooksSold Bookstore::ringUpAllCustomers( const ShoppingCarts & shoppingCarts )
 {
+  TRACE_SCOPE( "Checkout all customers" );
   BooksSold todaysSales;                                          // a collection of unique ISBNs of books sold
+  if( _inventoryChanged ) rebuildInventoryFilter();
 
   ///////////////////////// TO-DO (3) //////////////////////////////
     ///  Ring up each customer accumulating the books purchased
@@ -90,6 +140,7 @@ Bookstore::BooksSold Bookstore::ringUpAllCustomers( const ShoppingCarts & shoppi
 
 Bookstore::BooksSold Bookstore::ringUpCustomer( const ShoppingCart & shoppingCart )
 {
+  TRACE_SCOPE( "Checkout customer" );
   auto & worldWideBookDatabase = BookDatabase::instance();        // Get a reference to the database of all books in the world. The
                                                                   // database will contains a full description of the item and the
                                                                   // item's price.
@@ -115,10 +166,10 @@ Bookstore::BooksSold Bookstore::ringUpCustomer( const ShoppingCart & shoppingCar
     ///       2.2.3.2              Add the book's isbn to the list of books purchased
     ///       3         Print the total amount due on the receipt
 
-  double amountDue = 0;
+  Money amountDue;
 
   for (const auto& cartPair : shoppingCart) {
-    auto* book = worldWideBookDatabase.find(cartPair.first);
+    auto book = worldWideBookDatabase.find(cartPair.first);
     if (book == nullptr) {
       // Not found.
       std::cout
@@ -133,8 +184,10 @@ Bookstore::BooksSold Bookstore::ringUpCustomer( const ShoppingCart & shoppingCar
     purchasedBooks.insert(book->isbn());
 
     // Decrease the number of books in the inventory.
-    const auto& inventoryPair = _inventoryDB.find(cartPair.first);
-    inventoryPair->second--;
+    const auto& inventoryPair = findInInventory(cartPair.first);
+    if (inventoryPair != _inventoryDB.end()) {
+      inventoryPair->second--;
+    }
   }
 
   std::cout
@@ -154,9 +207,11 @@ Bookstore::BooksSold Bookstore::ringUpCustomer( const ShoppingCart & shoppingCar
 
 void Bookstore::reorderItems( BooksSold & todaysSales )
 {
+  TRACE_SCOPE( "Reorder items" );
   auto & worldWideBookDatabase = BookDatabase::instance();        // Get a reference to the database of all books in the world. The
                                                                   // database will contains a full description of the item and the
                                                                   // item's price.
+  if( _inventoryChanged ) rebuildInventoryFilter();
 
   ///////////////////////// TO-DO (5) //////////////////////////////
     /// For each book that has fallen below the reorder threshold, assume an order has been placed and now the shipment has
@@ -185,7 +240,7 @@ void Bookstore::reorderItems( BooksSold & todaysSales )
 
   for (const auto& soldISBN : todaysSales) {
     // Only a single lookup per iteration!
-    const auto& inventoryPair = _inventoryDB.find(soldISBN);
+    const auto& inventoryPair = findInInventory(soldISBN);
 
     bool isInInventory = inventoryPair != _inventoryDB.end();
     auto& qty = inventoryPair->second;
@@ -197,7 +252,7 @@ void Bookstore::reorderItems( BooksSold & todaysSales )
     std::cout << "\n " << idx << ":  ";
     idx++;
 
-    auto* book = worldWideBookDatabase.find(soldISBN);
+    auto book = worldWideBookDatabase.find(soldISBN);
     if (book == nullptr) {
       std::cout << "{" << std::quoted(soldISBN) << "}\n";
       continue;
@@ -231,6 +286,43 @@ void Bookstore::reorderItems( BooksSold & todaysSales )
 
 
 
+Bookstore::InventoryView::InventoryView( const Inventory_DB & inventory )
+{
+  std::vector<Utilities::PackedKey> keys;
+  keys.reserve( inventory.size() );
+  for( const auto & [isbn, quantity] : inventory )
+  {
+    auto key = Utilities::packKey( isbn );
+    if( !key )   throw std::length_error( "ISBN \"" + isbn + "\" is too long for an inventory view" );
+    keys.push_back( *key );
+  }
+
+  _index = Utilities::EytzingerIndex<Utilities::PackedKey>( keys );
+
+  _quantities.resize( inventory.size() );
+  for( std::size_t i = 0; const auto & [isbn, quantity] : inventory ) _quantities[_index.find( keys[i++] )] = quantity;
+}
+
+
+
+const unsigned int * Bookstore::InventoryView::find( const std::string & isbn ) const noexcept
+{
+  auto key  = Utilities::packKey( isbn );
+  auto slot = key ? _index.find( *key ) : _index.NOT_FOUND;
+  return slot == _index.NOT_FOUND ? nullptr : &_quantities[slot];
+}
+
+
+
+std::size_t Bookstore::InventoryView::size() const noexcept
+{ return _quantities.size(); }
+
+
+
+
+
+
+
 Bookstore::ShoppingCarts Bookstore::makeShoppingCarts()
 {
   // Our store has many customers, and each (identified by name) is pushing a shopping cart. Shopping carts are structured as
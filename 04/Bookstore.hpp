@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstddef>                                                                    // size_t
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "BloomFilter.hpp"
 #include "Book.hpp"
+#include "EytzingerIndex.hpp"
 
 
 
@@ -22,12 +26,36 @@ class Bookstore
                                                                                       //                                                             cart.  Notice that this structure is a tree, and each element in the
                                                                                       //                                                             tree is also a tree. That is, this is a tree of trees.
 
+    // A read only snapshot of an inventory, for lookups only.  Searched as a static Eytzinger tree (see EytzingerIndex) rather than
+    // the inventory's std::map, it's several times faster on a large inventory.
+    class InventoryView
+    {
+      public:
+        explicit InventoryView( const Inventory_DB & inventory );               // throws length_error if an ISBN is over 16 characters
+
+        const unsigned int * find( const std::string & isbn ) const noexcept;   // quantity on hand at the time of the snapshot, nullptr
+        std::size_t          size(                          ) const noexcept;   // if the store didn't carry the book
+
+      private:
+        Utilities::EytzingerIndex<Utilities::PackedKey> _index;
+        std::vector<unsigned int>                       _quantities;            // in _index's slot order
+    };
+
+
     // Constructors, assignments, destructor
     Bookstore( const std::string & persistentInventoryDB = "BookstoreInventory.dat" );
 
-    // Returns a reference to the store's one and only inventory database
+    // Returns a reference to the store's one and only inventory database.  The next batch (ringing up all customers, reordering)
+    // sees what's changed through it, so call it again before changing the inventory after a batch.
     Inventory_DB & getInventory();
 
+    // Returns a read only snapshot of the inventory database as it is now
+    InventoryView inventoryView() const;
+
+    // Returns the number of times the Bloom filter of the inventory's ISBNs has been built:  once on construction, and again at the
+    // start of the first batch (ringing up all customers, reordering) after each call to getInventory()
+    std::size_t inventoryFilterBuilds() const noexcept;
+
 
     // Each customer, in turn, places the books in their shopping cart on the checkout counter where they are scanned, paid for, and
     // issued a receipt. Returns a collection of unique ISBNs for books that have been sold
@@ -44,7 +72,11 @@ class Bookstore
 
   private:
     // Instance attributes
-    Inventory_DB _inventoryDB;                                                        // This store's inventory of books indexed by ISBN.
+    Inventory_DB           _inventoryDB;                                              // This store's inventory of books indexed by ISBN.
+    Utilities::BloomFilter _inventoryFilter;                                          // ISBNs in _inventoryDB, consulted before searching it
+    bool                   _inventoryChanged      = false;                            // getInventory() has handed out _inventoryDB since
+                                                                                      // _inventoryFilter was built, so it may have gained ISBNs
+    std::size_t            _inventoryFilterBuilds = 0;
 
 
     // Class attributes
@@ -53,5 +85,7 @@ class Bookstore
 
 
     // Helper functions
-    BooksSold ringUpCustomer( const ShoppingCart & shoppingCart );
+    BooksSold              ringUpCustomer        ( const ShoppingCart & shoppingCart );
+    Inventory_DB::iterator findInInventory       ( const std::string  & isbn         );  // _inventoryDB.find(), but misses rarely search
+    void                   rebuildInventoryFilter(                                   );
 };
@@ -0,0 +1,88 @@
+#include <algorithm>    // min()
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <numeric>      // iota()
+#include <string_view>
+#include <vector>
+
+#include "EditDistance.hpp"
+
+
+
+
+
+namespace Utilities
+{
+  EditDistance::EditDistance( std::string_view pattern )
+    : _pattern( pattern )
+  {
+    if( _pattern.size() > 64 )   return;
+
+    for( std::size_t i = 0; i < _pattern.size(); ++i ) _matches[static_cast<unsigned char>( _pattern[i] )] |= std::uint64_t{ 1 } << i;
+  }
+
+
+
+  std::size_t EditDistance::operator()( std::string_view text, std::size_t limit ) const
+  {
+    auto length = _pattern.size();
+
+    // Each insertion or deletion changes the length by one, so texts much longer or shorter can't be close
+    if( ( text.size() > length ? text.size() - length : length - text.size() ) > limit )   return limit + 1;
+    if( length == 0 )   return text.size();
+    if( length > 64 )   return longDistance( text, limit );
+
+    // positive and negative mark the rows of the current column that are one more and one less than the row above.  Only the last
+    // row, the distance from the whole pattern to the text so far, is tracked in score.
+    std::uint64_t positive = ~std::uint64_t{ 0 }, negative = 0;
+    std::uint64_t lastRow  = std::uint64_t{ 1 } << ( length - 1 );
+    std::size_t   score    = length;
+
+    for( std::size_t column = 0; column < text.size(); ++column )
+    {
+      auto equal      = _matches[static_cast<unsigned char>( text[column] )];
+      auto vertical   = equal | negative;
+      auto horizontal = ( ( ( equal & positive ) + positive ) ^ positive ) | equal;
+      auto plus       = negative | ~( horizontal | positive );
+      auto minus      = positive & horizontal;
+
+      if     ( plus  & lastRow ) ++score;
+      else if( minus & lastRow ) --score;
+
+      plus     = plus << 1 | 1;                                          // the distance from nothing grows by one each column
+      minus  <<= 1;
+      positive = minus | ~( vertical | plus );
+      negative = plus & vertical;
+
+      // The score can drop by at most one per character left
+      if( score > limit + ( text.size() - column - 1 ) )   return limit + 1;
+    }
+
+    return std::min( score, limit + 1 );
+  }
+
+
+
+  std::size_t EditDistance::longDistance( std::string_view text, std::size_t limit ) const
+  {
+    std::vector<std::size_t> row( text.size() + 1 );
+    std::iota( row.begin(), row.end(), std::size_t{ 0 } );
+
+    for( std::size_t i = 1; i <= _pattern.size(); ++i )
+    {
+      auto diagonal = row[0];
+      row[0]        = i;
+      auto smallest = row[0];
+      for( std::size_t j = 1; j <= text.size(); ++j )
+      {
+        auto above = row[j];
+        row[j]     = std::min( { above + 1, row[j - 1] + 1, diagonal + ( _pattern[i - 1] == text[j - 1] ? 0 : 1 ) } );
+        diagonal   = above;
+        smallest   = std::min( smallest, row[j] );
+      }
+      if( smallest > limit )   return limit + 1;
+    }
+
+    return std::min( row.back(), limit + 1 );
+  }
+}  // namespace Utilities
@@ -0,0 +1,40 @@
+/***********************************************************************************************************************************
+** Class EditDistance - The Levenshtein distance from one pattern to many texts, 64 characters at a time (Myers' bit-vector algorithm)
+**
+**      Utilities::EditDistance fromQuery( "tales of hans christain andersen" );
+**      if( fromQuery( title, 2 ) <= 2 ) ...                // title is at most 2 insertions, deletions, or substitutions away
+**
+**  The dynamic programming table's column for each character of text is held as bit vectors of the +1/-1 differences between
+**  neighboring cells, so a whole column is computed in a dozen word operations rather than one cell at a time.  Patterns longer than
+**  64 characters fall back to computing the table a row at a time.  Characters are bytes, so each byte of a UTF-8 letter counts.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <string>
+#include <string_view>
+
+
+
+
+
+namespace Utilities
+{
+  class EditDistance
+  {
+    public:
+      // Constructors
+      explicit EditDistance( std::string_view pattern );
+
+      // Queries
+      std::size_t operator()( std::string_view text, std::size_t limit ) const;            // the distance from the pattern to text, or
+                                                                                           // limit + 1 if it's more than limit
+    private:
+      std::size_t longDistance( std::string_view text, std::size_t limit ) const;
+
+      std::string                     _pattern;
+      std::array<std::uint64_t, 256>  _matches = {};                                       // bit i of _matches[c] is set if _pattern[i] == c
+  };
+}  // namespace Utilities
@@ -0,0 +1,155 @@
+/***********************************************************************************************************************************
+** Class EytzingerIndex - A build once, read only, sorted index laid out in Eytzinger (breadth first) order
+**
+**      Utilities::EytzingerIndex<Utilities::PackedKey> index( keys );   // keys in any order, but unique
+**      auto slot = index.find( key );                                  // key's slot in [0, keys.size()), or NOT_FOUND
+**
+**  Binary search over a sorted array touches a new cache line at nearly every step, scattered all over the array.  Laid out the way
+**  a heap is (the root, then its two children, then their four, ...) the first several levels share a handful of cache lines that
+**  stay cached, and a node's descendants a few levels down sit side by side, so they can be prefetched while the comparisons above
+**  them are still being made.  See Khuong and Morin, "Array Layouts for Comparison-Based Searching."
+**
+**  Slots are in Eytzinger order, not sorted order, so callers keep their values in a parallel array arranged by slot.
+**
+**  Key must be cheap to copy and totally ordered by <.  Small integers search fastest:  the comparison compiles to a conditional
+**  move, so there's no branch to mispredict.  PackedKey packs a short string (such as an ISBN) into one.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <algorithm>    // sort(), adjacent_find()
+#include <bit>          // countr_one()
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include <limits>       // numeric_limits
+#include <optional>
+#include <stdexcept>    // invalid_argument
+#include <string_view>
+#include <vector>
+
+#include "KeyHash.hpp"  // UInt128
+
+
+
+
+
+namespace Utilities
+{
+  // A string of up to 16 characters packed big-endian into an integer, so packed keys compare as the strings do (strings with
+  // embedded '\0's aside)
+  using PackedKey = UInt128;
+
+  inline std::optional<PackedKey> packKey( std::string_view text ) noexcept   // nothing if text is too long to pack
+  {
+    if( text.size() > sizeof( PackedKey ) )   return std::nullopt;
+    if( text.empty()                      )   return PackedKey{ 0 };
+
+    PackedKey key = 0;
+    for( unsigned char c : text ) key = key << 8 | c;
+    return key << 8 * ( sizeof( PackedKey ) - text.size() );
+  }
+
+
+
+
+  template<typename Key>
+  class EytzingerIndex
+  {
+    public:
+      inline static constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+
+      // Constructors
+      EytzingerIndex() = default;                                               // an index of no keys
+      explicit EytzingerIndex( std::vector<Key> keys );                         // keys must be unique
+
+      // Queries
+      std::size_t find( Key const & key ) const noexcept;                       // key's slot, or NOT_FOUND
+      std::size_t size(                 ) const noexcept;                       // number of keys, and so of slots
+
+
+    private:
+      // Keys this many slots apart fill a cache line, and a node's descendants log2 of that many levels down are that many adjacent keys
+      inline static constexpr std::size_t PER_LINE = std::bit_floor( std::max<std::size_t>( 1, 64 / sizeof( Key ) ) );
+
+      void place( std::vector<Key> const & sorted, std::size_t & next, std::size_t node ) noexcept;
+
+      std::size_t      _size   = 0;
+      std::size_t      _offset = 0;                                             // slot k's key is _keys[_offset + k], for 1 <= k <= _size
+      std::vector<Key> _keys;
+  };
+
+
+
+
+
+
+
+
+  /*******************************************************************************
+  ** Constructors
+  *******************************************************************************/
+  template<typename Key>
+  EytzingerIndex<Key>::EytzingerIndex( std::vector<Key> keys )
+    : _size( keys.size() ), _keys( keys.size() + 1 + PER_LINE )
+  {
+    std::sort( keys.begin(), keys.end() );
+    if( std::adjacent_find( keys.begin(), keys.end() ) != keys.end() )   throw std::invalid_argument( "Eytzinger index keys must be unique" );
+
+    // _offset is chosen so the descendants of slot k, PER_LINE * k through PER_LINE * k + PER_LINE - 1, share a cache line whenever
+    // the allocation's alignment allows
+    if( 64 % sizeof( Key ) == 0 )
+    {
+      auto misalignment = reinterpret_cast<std::uintptr_t>( _keys.data() ) % 64;
+      _offset           = ( 64 - misalignment ) % 64 / sizeof( Key );
+    }
+
+    std::size_t next = 0;
+    place( keys, next, 1 );
+  }
+
+
+
+
+  /*******************************************************************************
+  ** Queries
+  *******************************************************************************/
+  template<typename Key>
+  std::size_t EytzingerIndex<Key>::find( Key const & key ) const noexcept
+  {
+    auto const * slots = _keys.data() + _offset;
+
+    // Descend to a leaf, going right whenever the node is less than key.  The last left turn was at key's lower bound.
+    std::size_t k = 1;
+    while( k <= _size )
+    {
+      #if defined( __GNUC__ ) || defined( __clang__ )                          // the address may be past the end, but prefetching it is harmless
+        __builtin_prefetch( reinterpret_cast<void const *>( reinterpret_cast<std::uintptr_t>( slots ) + PER_LINE * k * sizeof( Key ) ) );
+      #endif
+      k = 2 * k + static_cast<std::size_t>( slots[k] < key );
+    }
+    k >>= std::countr_one( k ) + 1;
+
+    return k != 0  &&  slots[k] == key ? k - 1 : NOT_FOUND;
+  }
+
+
+
+  template<typename Key>
+  std::size_t EytzingerIndex<Key>::size() const noexcept
+  { return _size; }
+
+
+
+
+  /*******************************************************************************
+  ** Private implementation
+  *******************************************************************************/
+  template<typename Key>
+  void EytzingerIndex<Key>::place( std::vector<Key> const & sorted, std::size_t & next, std::size_t node ) noexcept   // an in-order walk
+  {
+    if( node > _size )   return;
+
+    place( sorted, next, 2 * node );
+    _keys[_offset + node] = sorted[next++];
+    place( sorted, next, 2 * node + 1 );
+  }
+}  // namespace Utilities
@@ -0,0 +1,180 @@
+#include <algorithm>    // mismatch(), min()
+#include <cstddef>      // size_t
+#include <functional>   // function
+#include <stdexcept>    // invalid_argument
+#include <string>
+#include <string_view>
+#include <utility>      // pair
+#include <vector>
+
+#include "FrontCodedDictionary.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  // Lengths are written 7 bits per byte, low bits first, with the high bit set on every byte but the last.  Nearly all fit in one.
+  void writeLength( std::string & out, std::size_t length )
+  {
+    for( ; length >= 0x80; length >>= 7 ) out += static_cast<char>( 0x80 | ( length & 0x7F ) );
+    out += static_cast<char>( length );
+  }
+
+
+
+  std::size_t readLength( std::string_view in, std::size_t & position ) noexcept
+  {
+    std::size_t length = 0;
+    for( unsigned shift = 0; ; shift += 7 )
+    {
+      auto byte = static_cast<unsigned char>( in[position++] );
+      length   |= std::size_t{ byte & 0x7FU } << shift;
+      if( byte < 0x80 )   return length;
+    }
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Utilities
+{
+  FrontCodedDictionary::FrontCodedDictionary( std::vector<std::string_view> const & sorted )
+    : _size( sorted.size() )
+  {
+    for( std::size_t i = 0; i < sorted.size(); ++i )
+    {
+      if( i > 0  &&  !( sorted[i - 1] < sorted[i] ) )   throw std::invalid_argument( "Front coded dictionary strings must be ascending and unique" );
+
+      std::size_t shared = 0;
+      if( i % BUCKET == 0 )   _buckets.push_back( _encoded.size() );                // stored whole
+      else
+      {
+        auto const & before = sorted[i - 1];
+        auto         limit  = std::min( before.size(), sorted[i].size() );
+        shared = static_cast<std::size_t>( std::mismatch( before.begin(), before.begin() + limit, sorted[i].begin() ).first - before.begin() );
+      }
+
+      writeLength( _encoded, shared );
+      writeLength( _encoded, sorted[i].size() - shared );
+      _encoded += sorted[i].substr( shared );
+    }
+
+    _encoded.shrink_to_fit();
+  }
+
+
+
+  std::size_t FrontCodedDictionary::find( std::string_view text ) const
+  {
+    auto rank = lowerBound( text );
+    return rank < _size  &&  at( rank ) == text ? rank : NOT_FOUND;
+  }
+
+
+
+  std::size_t FrontCodedDictionary::lowerBound( std::string_view text ) const
+  {
+    // The last bucket whose head isn't greater than text is the only one that can hold the first string not less than it
+    std::size_t first = 0, count = _buckets.size();
+    while( count > 0 )
+    {
+      auto half = count / 2;
+      if( !( text < head( first + half ) ) ) { first += half + 1;  count -= half + 1; }
+      else                                     count  = half;
+    }
+    if( first == 0 )   return 0;
+
+    auto        bucket   = first - 1;
+    auto        rank     = bucket * BUCKET;
+    auto        end      = std::min( rank + BUCKET, _size );
+    auto        position = _buckets[bucket];
+    std::string current;
+    for( ; rank < end; ++rank )
+    {
+      auto shared = readLength( _encoded, position );
+      auto length = readLength( _encoded, position );
+      current.resize( shared );
+      current.append( _encoded, position, length );
+      position += length;
+
+      if( !( current < text ) )   break;
+    }
+    return rank;
+  }
+
+
+
+  std::pair<std::size_t, std::size_t> FrontCodedDictionary::prefixRange( std::string_view prefix ) const
+  {
+    // The strings starting with prefix are those not less than it, but less than the shortest string greater than all of them:
+    // prefix with its last byte that can be incremented, incremented, and the bytes after that dropped
+    std::string past( prefix );
+    while( !past.empty()  &&  static_cast<unsigned char>( past.back() ) == 0xFF ) past.pop_back();
+    if( past.empty() )   return { lowerBound( prefix ), _size };
+
+    past.back() = static_cast<char>( static_cast<unsigned char>( past.back() ) + 1 );
+    return { lowerBound( prefix ), lowerBound( past ) };
+  }
+
+
+
+  std::string FrontCodedDictionary::at( std::size_t rank ) const
+  {
+    auto        position = _buckets[rank / BUCKET];
+    std::string current;
+    for( std::size_t i = rank / BUCKET * BUCKET; i <= rank; ++i )
+    {
+      auto shared = readLength( _encoded, position );
+      auto length = readLength( _encoded, position );
+      current.resize( shared );
+      current.append( _encoded, position, length );
+      position += length;
+    }
+    return current;
+  }
+
+
+
+  void FrontCodedDictionary::forEach( std::function<void( std::size_t rank, std::string_view text )> const & visit ) const
+  {
+    std::size_t position = 0;
+    std::string current;
+    for( std::size_t rank = 0; rank < _size; ++rank )
+    {
+      auto shared = readLength( _encoded, position );
+      auto length = readLength( _encoded, position );
+      current.resize( shared );
+      current.append( _encoded, position, length );
+      position += length;
+
+      visit( rank, current );
+    }
+  }
+
+
+
+  std::size_t FrontCodedDictionary::size() const noexcept
+  { return _size; }
+
+
+
+  std::size_t FrontCodedDictionary::bytes() const noexcept
+  { return _encoded.capacity() + _buckets.capacity() * sizeof( std::size_t ); }
+
+
+
+  std::string_view FrontCodedDictionary::head( std::size_t bucket ) const noexcept
+  {
+    auto position = _buckets[bucket];
+    readLength( _encoded, position );                                       // always 0, nothing shared
+    auto length = readLength( _encoded, position );
+    return std::string_view( _encoded ).substr( position, length );
+  }
+}  // namespace Utilities
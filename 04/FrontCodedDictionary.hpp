@@ -0,0 +1,58 @@
+/***********************************************************************************************************************************
+** Class FrontCodedDictionary - A build once, read only, compressed set of sorted strings, each identified by its rank
+**
+**      Utilities::FrontCodedDictionary titles( sortedTitles );          // ascending and unique
+**      auto id            = titles.find( "early aircraft" );              // that string's rank, or NOT_FOUND
+**      auto [first, last] = titles.prefixRange( "early" );                // ranks of every string starting with "early"
+**
+**  Sorted strings share long prefixes with their predecessors, so each is stored as the length of the prefix it shares with the one
+**  before it, followed by only the rest of it.  Every BUCKET-th string is stored whole, so a search binary searches those and then
+**  decodes at most one bucket.  A sorted list of book titles compresses to well under half its size this way.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <functional>   // function
+#include <limits>       // numeric_limits
+#include <string>
+#include <string_view>
+#include <utility>      // pair
+#include <vector>
+
+
+
+
+
+namespace Utilities
+{
+  class FrontCodedDictionary
+  {
+    public:
+      inline static constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+
+
+      // Constructors
+      FrontCodedDictionary() = default;                                                  // an empty dictionary
+      explicit FrontCodedDictionary( std::vector<std::string_view> const & sorted );     // throws invalid_argument unless ascending and unique
+
+      // Queries
+      std::size_t                         find       ( std::string_view text   ) const;  // text's rank, or NOT_FOUND
+      std::size_t                         lowerBound ( std::string_view text   ) const;  // rank of the first string not less than text
+      std::pair<std::size_t, std::size_t> prefixRange( std::string_view prefix ) const;  // ranks [first, last) of the strings starting with prefix
+      std::string                         at         ( std::size_t      rank   ) const;  // the string of that rank, which must be less than size()
+      std::size_t                         size       (                         ) const noexcept;
+      std::size_t                         bytes      (                         ) const noexcept;   // memory used by the dictionary
+
+      void forEach( std::function<void( std::size_t rank, std::string_view text )> const & visit ) const;   // every string, in order
+
+
+    private:
+      inline static constexpr std::size_t BUCKET = 16;                                   // strings per bucket, the first stored whole
+
+      std::string_view head( std::size_t bucket ) const noexcept;                        // a bucket's first string
+
+      std::string              _encoded;                                                 // each string as (shared prefix length, suffix length, suffix)
+      std::vector<std::size_t> _buckets;                                                 // where each bucket starts in _encoded
+      std::size_t              _size = 0;
+  };
+}  // namespace Utilities
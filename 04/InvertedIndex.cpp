@@ -0,0 +1,290 @@
+#include <algorithm>    // sort(), unique(), nth_element(), max()
+#include <bit>          // bit_ceil()
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uint8_t
+#include <limits>       // numeric_limits
+#include <span>
+#include <stdexcept>    // length_error
+#include <string>
+#include <string_view>
+#include <utility>      // pair
+#include <vector>
+
+#include "EditDistance.hpp"
+#include "FrontCodedDictionary.hpp"
+#include "InvertedIndex.hpp"
+#include "KeyHash.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  // Letters, digits, and bytes outside ASCII (parts of UTF-8 letters).  Everything else separates words.
+  constexpr bool isWordCharacter( unsigned char c ) noexcept
+  { return ( c >= 'a' && c <= 'z' )  ||  ( c >= 'A' && c <= 'Z' )  ||  ( c >= '0' && c <= '9' )  ||  c >= 0x80; }
+
+
+
+  constexpr std::size_t GRAM       = 3;                                   // characters per n-gram
+  constexpr std::size_t SHORT_TERM = 32;                                  // terms this long or shorter are also kept whole, by length
+
+  // The bucket of the trigram starting at text[i].  buckets must be a power of two.
+  std::size_t gramBucket( std::string_view text, std::size_t i, std::size_t buckets ) noexcept
+  {
+    std::uint64_t gram = 0;
+    for( std::size_t j = i; j < i + GRAM; ++j ) gram = gram << 8 | static_cast<unsigned char>( text[j] );
+    return Utilities::mix64( gram ) & ( buckets - 1 );
+  }
+
+
+
+  // The buckets of text's distinct trigrams, in ascending order
+  void gramBucketsOf( std::string_view text, std::size_t buckets, std::vector<std::size_t> & result )
+  {
+    result.clear();
+    for( std::size_t i = 0; i + GRAM <= text.size(); ++i ) result.push_back( gramBucket( text, i, buckets ) );
+    std::sort( result.begin(), result.end() );
+    result.erase( std::unique( result.begin(), result.end() ), result.end() );
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+namespace Utilities
+{
+  InvertedIndex::InvertedIndex( std::vector<std::string_view> const & terms )
+  {
+    if( terms.size() >= std::numeric_limits<Posting>::max() )   throw std::length_error( "Too many records for an inverted index" );
+
+    std::vector<std::string> normalized;
+    normalized.reserve( terms.size() );
+    for( auto text : terms ) normalized.push_back( normalize( text ) );
+
+    // Records grouped by term, each group in ascending record order, are exactly the postings.  Sorting (term, record) pairs keeps
+    // each comparison's data side by side rather than chasing record numbers back into normalized.
+    std::vector<std::pair<std::string_view, Posting>> byTerm;
+    byTerm.reserve( terms.size() );
+    for( std::size_t i = 0; i < normalized.size(); ++i ) byTerm.emplace_back( normalized[i], static_cast<Posting>( i ) );
+    std::sort( byTerm.begin(), byTerm.end() );
+
+    std::vector<std::string_view> distinct;
+    _postings.reserve( byTerm.size() );
+    for( auto const & [text, record] : byTerm )
+    {
+      if( distinct.empty()  ||  distinct.back() != text )
+      {
+        _offsets.push_back( static_cast<Posting>( _postings.size() ) );
+        distinct.push_back( text );
+      }
+      _postings.push_back( record );
+    }
+    _offsets.push_back( static_cast<Posting>( _postings.size() ) );
+
+    _dictionary = FrontCodedDictionary( distinct );
+  }
+
+
+
+  std::span<const InvertedIndex::Posting> InvertedIndex::find( std::string_view text ) const
+  {
+    auto id = _dictionary.find( normalize( text ) );
+    return id == FrontCodedDictionary::NOT_FOUND ? std::span<const Posting>{} : postings( id );
+  }
+
+
+
+  std::vector<std::span<const InvertedIndex::Posting>> InvertedIndex::complete( std::string_view prefix, std::size_t count ) const
+  {
+    auto [first, last] = prefixIds( prefix );
+
+    std::vector<std::span<const Posting>> completions;
+    for( auto id = first; id < last  &&  completions.size() < count; ++id ) completions.push_back( postings( id ) );
+    return completions;
+  }
+
+
+
+  std::pair<std::size_t, std::size_t> InvertedIndex::prefixIds( std::string_view prefix ) const
+  {
+    auto wanted        = normalize( prefix );
+    auto [first, last] = _dictionary.prefixRange( wanted );
+
+    // A prefix ending between words, like "tales of ", matches "tales of" and "tales of hans" but not "tales offered".  No normalized
+    // term has a character less than ' ' to fall between the first two.
+    if( !wanted.empty()  &&  !isWordCharacter( static_cast<unsigned char>( prefix.back() ) ) )   last = _dictionary.prefixRange( wanted + ' ' ).second;
+
+    return { first, last };
+  }
+
+
+
+  std::vector<InvertedIndex::Posting> InvertedIndex::termIds() const
+  {
+    std::vector<Posting> ids( _postings.size() );
+    for( std::size_t id = 0; id < terms(); ++id ) for( auto record : postings( id ) ) ids[record] = static_cast<Posting>( id );
+    return ids;
+  }
+
+
+
+  std::vector<std::span<const InvertedIndex::Posting>> InvertedIndex::fuzzyFind( std::string_view text, std::size_t maxEdits, std::size_t count ) const
+  {
+    auto         wanted = normalize( text );
+    EditDistance distanceFrom( wanted );
+
+    std::vector<std::pair<std::size_t, std::size_t>> close;                       // (distance, term id)
+    auto consider = [&]( std::size_t id, std::string_view term )
+    {
+      if( auto distance = distanceFrom( term, maxEdits );  distance <= maxEdits )   close.emplace_back( distance, id );
+    };
+
+    // An edit changes at most GRAM of wanted's trigrams, so a term within maxEdits has all but GRAM * maxEdits of any of them.  Only
+    // the terms having enough of the rarest few need checking.  Twice the fewest that could work filters out far more terms than it
+    // costs to count.
+    auto grams     = wanted.size() >= GRAM ? wanted.size() - GRAM + 1 : 0;
+    auto tolerated = GRAM * maxEdits;
+    auto shortest  = wanted.size() > maxEdits ? wanted.size() - maxEdits : 0;
+    auto longest   = wanted.size() + maxEdits;
+
+    if( !_gramOffsets.empty()  &&  grams > tolerated )
+    {
+      std::vector<std::span<const Posting>> lists;
+      for( std::size_t i = 0; i < grams; ++i )
+      {
+        auto bucket = gramBucket( wanted, i, _gramOffsets.size() - 1 );
+        lists.push_back( std::span( _gramTerms ).subspan( _gramOffsets[bucket], _gramOffsets[bucket + 1] - _gramOffsets[bucket] ) );
+      }
+
+      auto chosen    = std::min( { grams, 2 * ( tolerated + 1 ), std::size_t{ 255 } } );
+      auto threshold = chosen - tolerated;
+      std::nth_element( lists.begin(), lists.begin() + static_cast<std::ptrdiff_t>( chosen - 1 ), lists.end(),
+                        []( auto const & lhs, auto const & rhs ) noexcept { return lhs.size() < rhs.size(); } );
+      lists.resize( chosen );
+
+      // Count how many of the lists each term is in, checking each the moment it's in enough
+      std::vector<std::uint8_t> hits( terms() );
+      for( auto const & list : lists ) for( auto id : list ) if( ++hits[id] == threshold )   consider( id, _dictionary.at( id ) );
+    }
+
+    // Too short a term to have that many trigrams is checked against every term of about its length
+    else if( !_gramOffsets.empty()  &&  longest <= SHORT_TERM )
+    {
+      for( auto length = shortest; length <= longest; ++length )
+      {
+        auto sameLength = std::string_view( _shortTerms ).substr( _shortTextOffsets[length], _shortTextOffsets[length + 1] - _shortTextOffsets[length] );
+        for( auto i = _shortIdOffsets[length]; i < _shortIdOffsets[length + 1]; ++i, sameLength.remove_prefix( length ) ) consider( _shortIds[i], sameLength.substr( 0, length ) );
+      }
+    }
+
+    else _dictionary.forEach( consider );
+
+    std::sort( close.begin(), close.end() );                                      // closest first, then alphabetically
+    if( close.size() > count )   close.resize( count );
+
+    std::vector<std::span<const Posting>> matches;
+    for( auto [distance, id] : close ) matches.push_back( postings( id ) );
+    return matches;
+  }
+
+
+
+  std::size_t InvertedIndex::terms() const noexcept
+  { return _dictionary.size(); }
+
+
+
+  std::size_t InvertedIndex::bytes() const noexcept
+  {
+    return _dictionary.bytes()
+         + _offsets    .capacity() * sizeof( Posting )
+         + _postings   .capacity() * sizeof( Posting )
+         + _gramOffsets.capacity() * sizeof( Posting )
+         + _gramTerms  .capacity() * sizeof( Posting )
+         + _shortTerms .capacity()
+         + _shortIds   .capacity() * sizeof( Posting );
+  }
+
+
+
+  void InvertedIndex::renumber( std::vector<Posting> const & newNumbers )
+  {
+    for( auto & posting : _postings ) posting = newNumbers[posting];
+
+    for( std::size_t id = 0; id < terms(); ++id ) std::sort( _postings.begin() + _offsets[id], _postings.begin() + _offsets[id + 1] );
+  }
+
+
+
+  void InvertedIndex::indexGrams()
+  {
+    if( !_gramOffsets.empty() )   return;
+
+    // Bucketed by hash so the offsets stay small whatever the alphabet.  Terms sharing a bucket only by chance are filtered out when
+    // their distances are checked.
+    auto                     buckets = std::bit_ceil( std::max<std::size_t>( 1024, terms() ) );
+    std::vector<std::size_t> termBuckets;
+
+    _gramOffsets     .assign( buckets    + 1, 0 );
+    _shortIdOffsets  .assign( SHORT_TERM + 2, 0 );
+    _shortTextOffsets.assign( SHORT_TERM + 2, 0 );
+    _dictionary.forEach( [&]( std::size_t, std::string_view term )
+    {
+      gramBucketsOf( term, buckets, termBuckets );
+      for( auto bucket : termBuckets ) ++_gramOffsets[bucket + 1];
+
+      if( term.size() <= SHORT_TERM ) { ++_shortIdOffsets[term.size() + 1];  _shortTextOffsets[term.size() + 1] += term.size(); }
+    } );
+    for( std::size_t b = 1; b <= buckets;        ++b ) _gramOffsets[b] += _gramOffsets[b - 1];
+    for( std::size_t l = 1; l <= SHORT_TERM + 1; ++l )
+    {
+      _shortIdOffsets  [l] += _shortIdOffsets  [l - 1];
+      _shortTextOffsets[l] += _shortTextOffsets[l - 1];
+    }
+
+    _gramTerms .resize( _gramOffsets     .back() );
+    _shortIds  .resize( _shortIdOffsets  .back() );
+    _shortTerms.resize( _shortTextOffsets.back() );
+    auto nextGram  = _gramOffsets;
+    auto nextShort = _shortIdOffsets;
+    _dictionary.forEach( [&]( std::size_t id, std::string_view term )
+    {
+      gramBucketsOf( term, buckets, termBuckets );
+      for( auto bucket : termBuckets ) _gramTerms[nextGram[bucket]++] = static_cast<Posting>( id );
+
+      if( term.size() <= SHORT_TERM )
+      {
+        auto & next = nextShort[term.size()];
+        _shortTerms.replace( _shortTextOffsets[term.size()] + ( next - _shortIdOffsets[term.size()] ) * term.size(), term.size(), term );
+        _shortIds[next++] = static_cast<Posting>( id );
+      }
+    } );
+  }
+
+
+
+  std::string InvertedIndex::normalize( std::string_view text )
+  {
+    std::string result;
+    result.reserve( text.size() );
+
+    bool separate = false;
+    for( unsigned char c : text )
+    {
+      if( !isWordCharacter( c ) ) { separate = !result.empty();  continue; }
+
+      if( separate ) { result += ' ';  separate = false; }
+      result += static_cast<char>( c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c );
+    }
+
+    return result;
+  }
+
+
+
+  std::span<const InvertedIndex::Posting> InvertedIndex::postings( std::size_t id ) const noexcept
+  { return std::span( _postings ).subspan( _offsets[id], _offsets[id + 1] - _offsets[id] ); }
+}  // namespace Utilities
@@ -0,0 +1,82 @@
+/***********************************************************************************************************************************
+** Class InvertedIndex - A build once, read only map from a term (an author, a title) to the records having that term
+**
+**      Utilities::InvertedIndex authors( authorOfEachRecord );   // authorOfEachRecord[i] is record i's term
+**      for( auto record : authors.find( "Rosemary Sullivan" ) ) ...
+**      for( auto records : titles.complete( "tales of h", 10 ) ) ...    // the first 10 titles starting with "tales of h", in order
+**      for( auto records : titles.fuzzyFind( "tales of hnas", 2, 10 ) ) ...   // the 10 titles fewest typos away, closest first
+**
+**  Terms are normalized (see normalize()), so "ROSEMARY  sullivan" finds the same records.  Each distinct term is stored once, in a
+**  sorted, front coded dictionary whose ranks are the terms' ids, and each id's postings are the numbers of the records having that
+**  term, ascending, in one shared array.  A query is a search of the dictionary followed by a span of the postings, nothing copied.
+**
+**  Fuzzy queries need an index of each term's trigrams (3 character substrings) to be fast, which is built only on request because
+**  it costs about 4 bytes per character of the distinct terms.  Short terms, which have too few trigrams to filter on, are also kept
+**  whole, grouped by length.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>      // pair
+#include <vector>
+
+#include "FrontCodedDictionary.hpp"
+
+
+
+
+
+namespace Utilities
+{
+  class InvertedIndex
+  {
+    public:
+      using Posting = std::uint32_t;                                                     // a record's number
+
+
+      // Constructors
+      InvertedIndex() = default;                                                         // an index of no records
+      explicit InvertedIndex( std::vector<std::string_view> const & terms );             // terms[i] is record i's term
+
+      // Queries
+      std::span<const Posting>              find    ( std::string_view term                     ) const;   // records having term, ascending
+      std::vector<std::span<const Posting>> complete( std::string_view prefix, std::size_t count ) const;   // records having each of the first
+                                                                                                            // count terms starting with prefix
+      std::vector<std::span<const Posting>> fuzzyFind( std::string_view term, std::size_t maxEdits, std::size_t count ) const;  // records having each of
+                                                                                                            // the count terms closest to term, within
+                                                                                                            // maxEdits insertions, deletions, or substitutions
+      std::pair<std::size_t, std::size_t>   prefixIds( std::string_view prefix                  ) const;   // ids [first, last) of the terms starting with
+                                                                                                            // prefix, which are in order
+      std::vector<Posting>                  termIds (                                           ) const;   // the id of each record's term, by record
+      std::size_t                           terms   (                                           ) const noexcept;   // number of distinct terms
+      std::size_t                           bytes   (                                           ) const noexcept;   // memory used by the index
+
+      // Modifiers
+      void renumber  ( std::vector<Posting> const & newNumbers );                        // record i is now record newNumbers[i]
+      void indexGrams(                                         );                        // makes fuzzyFind() fast, does nothing if already done
+
+      // Lower case, with every run of whitespace and punctuation replaced by a single space, and none at either end.  Bytes
+      // outside ASCII (UTF-8 letters) are kept as they are.  Ex:  "Shadow maker \"1st edition)\""  ->  "shadow maker 1st edition"
+      static std::string normalize( std::string_view text );
+
+
+    private:
+      std::span<const Posting> postings( std::size_t id ) const noexcept;
+
+      FrontCodedDictionary     _dictionary;                                              // the distinct normalized terms, sorted
+      std::vector<Posting>     _offsets;                                                 // term id's postings are _postings[_offsets[id], _offsets[id+1])
+      std::vector<Posting>     _postings;
+
+      std::vector<Posting>     _gramOffsets;                                             // the ids of the terms having a trigram in bucket b are
+      std::vector<Posting>     _gramTerms;                                               // _gramTerms[_gramOffsets[b], _gramOffsets[b+1]), ascending
+
+      std::string              _shortTerms;                                              // the short terms of length l, end to end, are
+      std::vector<std::size_t> _shortTextOffsets;                                        // _shortTerms[_shortTextOffsets[l], _shortTextOffsets[l+1]),
+      std::vector<Posting>     _shortIds;                                                // and their ids
+      std::vector<Posting>     _shortIdOffsets;                                          // _shortIds[_shortIdOffsets[l], _shortIdOffsets[l+1])
+  };
+}  // namespace Utilities
@@ -0,0 +1,140 @@
+#include <charconv>     // to_chars_result, from_chars_result
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <cstring>      // memcpy()
+#include <istream>
+#include <limits>       // numeric_limits
+#include <ostream>
+#include <string_view>
+#include <system_error> // errc
+
+#include "Money.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  constexpr bool isDigit( int c ) noexcept
+  { return c >= '0'  &&  c <= '9'; }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+std::to_chars_result to_chars( char * first, char * last, Money value ) noexcept
+{
+  // Digits come out least significant first, so they're written backwards into a buffer big enough for any amount, then copied.
+  // The magnitude is unsigned so the most negative amount has one too.
+  char   text[Money::MAX_CHARS];
+  char * end   = text + Money::MAX_CHARS;
+  char * start = end;
+
+  auto cents     = value.cents();
+  auto magnitude = cents < 0 ? 0 - static_cast<std::uint64_t>( cents ) : static_cast<std::uint64_t>( cents );
+
+  *--start = static_cast<char>( '0' + magnitude % 10 );   magnitude /= 10;
+  *--start = static_cast<char>( '0' + magnitude % 10 );   magnitude /= 10;
+  *--start = '.';
+  do { *--start = static_cast<char>( '0' + magnitude % 10 );   magnitude /= 10; } while( magnitude != 0 );
+  if( cents < 0 ) *--start = '-';
+
+  auto length = static_cast<std::size_t>( end - start );
+  if( static_cast<std::size_t>( last - first ) < length )   return { last, std::errc::value_too_large };
+
+  std::memcpy( first, start, length );
+  return { first + length, std::errc{} };
+}
+
+
+
+std::from_chars_result from_chars( char const * first, char const * last, Money & value ) noexcept
+{
+  auto next     = first;
+  bool negative = next != last  &&  *next == '-';
+  if( negative ) ++next;
+
+  // Dollars are gathered into an unsigned magnitude a digit at a time, noting, rather than stopping at, overflow so the whole
+  // number is still consumed
+  constexpr std::uint64_t LIMIT       = std::numeric_limits<Money::Cents>::max();   // in cents, one more for negative amounts
+  constexpr std::uint64_t MAX_DOLLARS = LIMIT / 100;
+
+  std::uint64_t dollars  = 0;
+  bool          tooLarge = false;
+  auto          digits   = next;
+  for( ; next != last  &&  isDigit( *next ); ++next )
+  {
+    if( dollars > MAX_DOLLARS )   tooLarge = true;
+    else                          dollars  = dollars * 10 + static_cast<std::uint64_t>( *next - '0' );
+  }
+  bool anyDollars = next != digits;
+
+  std::uint64_t cents    = 0;
+  bool          anyCents = false;
+  if( next != last  &&  *next == '.' )
+  {
+    auto fraction = next + 1;
+    auto place    = fraction;
+    for( std::uint64_t scale = 10; place != last  &&  isDigit( *place ); ++place )
+    {
+      if( scale > 0 )  cents += scale * static_cast<std::uint64_t>( *place - '0' );
+      else if( place == fraction + 2  &&  *place >= '5' )   ++cents;               // round the third digit, ignore the rest
+      scale /= 10;
+    }
+    anyCents = place != fraction;
+    if( anyDollars  ||  anyCents )   next = place;                                  // "12." is twelve dollars, but "." isn't money
+  }
+
+  if( !anyDollars  &&  !anyCents )   return { first, std::errc::invalid_argument };
+
+  if( dollars > MAX_DOLLARS )   tooLarge = true;
+  auto magnitude = dollars * 100 + cents;
+  if( tooLarge  ||  magnitude > LIMIT + ( negative ? 1 : 0 ) )   return { next, std::errc::result_out_of_range };
+
+  value = Money::fromCents( negative ? static_cast<Money::Cents>( 0 - magnitude ) : static_cast<Money::Cents>( magnitude ) );
+  return { next, std::errc{} };
+}
+
+
+
+
+
+
+
+
+std::ostream & operator<<( std::ostream & stream, Money value )
+{
+  char text[Money::MAX_CHARS];
+  auto [end, error] = to_chars( text, text + Money::MAX_CHARS, value );                // can't fail, the buffer fits any amount
+  return stream << std::string_view( text, static_cast<std::size_t>( end - text ) );
+}
+
+
+
+std::istream & operator>>( std::istream & stream, Money & value )
+{
+  // Gather the characters money could be made of, as extracting a number would, then convert them.  Like extracting a number,
+  // leading whitespace is skipped and value is left as it was if there's no money to read.
+  std::istream::sentry ready( stream );
+  if( !ready )   return stream;
+
+  char        text[64];
+  std::size_t length = 0;
+  for( auto c = stream.peek();  length < sizeof( text )  &&  ( isDigit( c )  ||  c == '.'  ||  ( c == '-'  &&  length == 0 ) );  c = stream.peek() )
+  {
+    text[length++] = static_cast<char>( c );
+    stream.ignore();
+  }
+
+  Money read;
+  auto [end, error] = from_chars( text, text + length, read );
+  if( error != std::errc{}  ||  end != text + length )   stream.setstate( std::ios::failbit );
+  else                                                  value = read;
+
+  return stream;
+}
@@ -0,0 +1,73 @@
+/***********************************************************************************************************************************
+** Class Money - An exact amount of US dollars, counted in whole cents
+**
+**      Money price = 65.65;                                               // from dollars, to the nearest cent
+**      Money total = price * 3 + Money::fromCents( 1'99 );                // $198.94 exactly, however many amounts are added
+**      auto [end, error] = to_chars( buffer, buffer + size, total );      // "198.94", and from_chars() reads it back
+**
+**  Most amounts of cents can't be held exactly in a double (0.10 is really 0.1000000000000000055...), so sums of them drift and
+**  comparing them takes an epsilon.  Sixty-four bits of cents hold any amount to 92 quadrillion dollars either way, add and compare
+**  in single integer instructions, and sum to the same cent in any order.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <charconv>     // to_chars_result, from_chars_result
+#include <compare>      // strong_ordering
+#include <cstddef>      // size_t
+#include <cstdint>      // int64_t
+#include <iosfwd>       // istream, ostream
+
+
+
+
+class Money
+{
+  // Insertion and Extraction Operators                                             // as to_chars() and from_chars() write and read
+  friend std::ostream & operator<<( std::ostream & stream, Money   value );
+  friend std::istream & operator>>( std::istream & stream, Money & value );
+
+  public:
+    using Cents = std::int64_t;
+
+    inline static constexpr std::size_t MAX_CHARS = 21;                              // the longest to_chars() writes, "-92233720368547758.08"
+
+
+    // Constructors
+    constexpr Money(                ) noexcept = default;                            // $0.00
+    constexpr Money( double dollars ) noexcept                                       // Conversion (from dollars to Money) constructor, to
+      : _cents( static_cast<Cents>( dollars * 100.0 + ( dollars < 0.0 ? -0.5 : 0.5 ) ) )   // the nearest cent
+    {}
+
+    static constexpr Money fromCents( Cents cents ) noexcept { Money money;  money._cents = cents;  return money; }
+
+    // Queries
+    constexpr Cents  cents  () const noexcept { return _cents; }
+    constexpr double dollars() const noexcept { return static_cast<double>( _cents ) / 100.0; }   // for display and estimates, not sums
+
+    // Arithmetic
+    constexpr Money & operator+=( Money rhs   ) noexcept { _cents += rhs._cents;  return *this; }
+    constexpr Money & operator-=( Money rhs   ) noexcept { _cents -= rhs._cents;  return *this; }
+    constexpr Money & operator*=( Cents count ) noexcept { _cents *= count;       return *this; }
+
+    friend constexpr Money operator+( Money lhs,   Money rhs   ) noexcept { return lhs += rhs;   }
+    friend constexpr Money operator-( Money lhs,   Money rhs   ) noexcept { return lhs -= rhs;   }
+    friend constexpr Money operator-( Money value              ) noexcept { return fromCents( -value._cents ); }
+    friend constexpr Money operator*( Money lhs,   Cents count ) noexcept { return lhs *= count; }
+    friend constexpr Money operator*( Cents count, Money rhs   ) noexcept { return rhs *= count; }
+
+    // Relational Operators                                                         // one integer comparison, no epsilon
+    constexpr std::strong_ordering operator<=>( Money const & rhs ) const noexcept = default;
+    constexpr bool                 operator== ( Money const & rhs ) const noexcept = default;
+
+  private:
+    Cents _cents = 0;
+};
+
+
+
+
+// Formatting, in the manner of std::to_chars() and std::from_chars().  Money is written as [-]dollars.cents, always with two digits
+// of cents and without a currency sign.  It's read the same way, except the cents are optional and digits past them round to the
+// nearest cent.  Neither skips leading whitespace, allocates, or depends on the locale.
+std::to_chars_result   to_chars  ( char       * first, char       * last, Money   value ) noexcept;
+std::from_chars_result from_chars( char const * first, char const * last, Money & value ) noexcept;
@@ -0,0 +1,266 @@
+#include <algorithm>    // sort(), adjacent_find(), lower_bound(), min(), max()
+#include <bit>          // popcount()
+#include <cmath>        // ceil()
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uint32_t, uint8_t
+#include <functional>   // greater_equal
+#include <iostream>
+#include <stdexcept>    // invalid_argument
+#include <string_view>
+#include <utility>      // move()
+#include <vector>
+
+#include "KeyHash.hpp"
+#include "PerfectHashIndex.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  constexpr std::size_t MAX_RESEEDS = 8;                                      // two distinct keys sharing a 64-bit hash this often means they aren't distinct
+  constexpr std::size_t READ_CHUNK  = 1 << 20;                                // elements read at a time, so a corrupt count fails before it allocates much
+
+  std::uint64_t levelHash( std::uint64_t hash, std::size_t level ) noexcept
+  { return Utilities::mix64( hash ^ ( ( level + 1 ) * 0x9E37'79B9'7F4A'7C15ULL ) ); }
+
+  std::uint8_t fingerprint( std::uint64_t hash ) noexcept
+  { return static_cast<std::uint8_t>( hash >> 56 ); }
+
+  std::uint64_t digestOf( std::vector<std::string_view> const & keys ) noexcept   // independent of order
+  {
+    std::uint64_t digest = keys.size();
+    for( auto key : keys ) digest += Utilities::keyHash( key );
+    return digest;
+  }
+
+
+
+  template<typename T>
+  void write( std::ostream & stream, T const & value )
+  { stream.write( reinterpret_cast<char const *>( &value ), sizeof( value ) ); }
+
+  template<typename T>
+  void write( std::ostream & stream, std::vector<T> const & values )
+  {
+    write( stream, values.size() );
+    stream.write( reinterpret_cast<char const *>( values.data() ), static_cast<std::streamsize>( values.size() * sizeof( T ) ) );
+  }
+
+  template<typename T>
+  void read( std::istream & stream, T & value )
+  {
+    if( !stream.read( reinterpret_cast<char *>( &value ), sizeof( value ) ) )   throw Utilities::PerfectHashIndex::Format_Ex( "Saved perfect hash index is truncated" );
+  }
+
+  template<typename T>
+  void read( std::istream & stream, std::vector<T> & values )
+  {
+    std::size_t count = 0;
+    read( stream, count );
+
+    values.clear();
+    while( values.size() < count )
+    {
+      auto done = values.size();
+      values.resize( done + std::min( count - done, READ_CHUNK ) );
+      if( !stream.read( reinterpret_cast<char *>( values.data() + done ), static_cast<std::streamsize>( ( values.size() - done ) * sizeof( T ) ) ) )
+      {
+        throw Utilities::PerfectHashIndex::Format_Ex( "Saved perfect hash index is truncated" );
+      }
+    }
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Utilities
+{
+  /*******************************************************************************
+  ** Constructors
+  *******************************************************************************/
+  PerfectHashIndex::PerfectHashIndex( std::vector<std::string_view> const & keys )
+    : _keysDigest( digestOf( keys ) ), _size( keys.size() )
+  {
+    std::vector<std::uint64_t> hashes( keys.size() );
+
+    for( ;; ++_seed )
+    {
+      if( _seed == MAX_RESEEDS )   throw std::invalid_argument( "Perfect hash index keys must be unique" );
+      for( std::size_t i = 0; i < keys.size(); ++i ) hashes[i] = keyHash( keys[i], _seed );
+
+      // Place what can be placed at each level, and pass the rest to the next
+      std::vector<std::uint64_t> remaining = hashes;
+      _levelWords = { 0 };
+      _bits.clear();
+
+      for( std::size_t level = 0;  level < MAX_LEVELS  &&  !remaining.empty();  ++level )
+      {
+        auto words = std::max<std::size_t>( 1, static_cast<std::size_t>( std::ceil( GAMMA * static_cast<double>( remaining.size() ) / 64.0 ) ) );
+        std::vector<std::uint64_t> placed( words ), collided( words );
+
+        for( auto hash : remaining )
+        {
+          auto bit  = fastRange( levelHash( hash, level ), words * 64 );
+          auto mask = 1ULL << bit % 64;
+          auto & p  = placed  [bit / 64];
+          auto & c  = collided[bit / 64];
+
+          if     ( c & mask ) /* already shared */ ;
+          else if( p & mask ) { p &= ~mask;  c |= mask; }
+          else                  p |=  mask;
+        }
+
+        std::erase_if( remaining, [&]( std::uint64_t hash ) noexcept
+        {
+          auto bit = fastRange( levelHash( hash, level ), words * 64 );
+          return ( placed[bit / 64] >> bit % 64 & 1 ) != 0;
+        } );
+
+        _bits.insert( _bits.end(), placed.begin(), placed.end() );
+        _levelWords.push_back( _bits.size() );
+      }
+
+      // Whatever's left after MAX_LEVELS (rarely anything) takes the last slots, in hash order.  Keys only stay this long if they
+      // collide at every level, and two keys with the same hash always do, so that's where a collision would turn up.
+      std::sort( remaining.begin(), remaining.end() );
+      if( std::adjacent_find( remaining.begin(), remaining.end() ) == remaining.end() )
+      {
+        _fallback = std::move( remaining );
+        break;
+      }
+    }
+
+    rank();
+
+    _fingerprints.assign( _size, 0 );
+    for( auto hash : hashes ) _fingerprints[slotOf( hash )] = fingerprint( hash );
+  }
+
+
+
+
+  PerfectHashIndex::PerfectHashIndex( std::vector<std::string_view> const & keys, std::istream & saved )
+    : _keysDigest( digestOf( keys ) ), _size( keys.size() )
+  {
+    std::uint64_t signature = 0, keysDigest = 0;
+    std::size_t   size      = 0;
+
+    read( saved, signature );
+    if( signature != FILE_SIGNATURE )                         throw Format_Ex( "Not a saved perfect hash index" );
+
+    read( saved, keysDigest );
+    read( saved, size       );
+    if( keysDigest != _keysDigest  ||  size != _size )        throw Format_Ex( "Saved perfect hash index was built for different keys" );
+
+    read( saved, _seed         );
+    read( saved, _levelWords   );
+    read( saved, _bits         );
+    read( saved, _fallback     );
+    read( saved, _fingerprints );
+
+    if( _levelWords.empty()  ||  _levelWords.front() != 0  ||  _levelWords.back() != _bits.size()  ||  std::adjacent_find( _levelWords.begin(), _levelWords.end(), std::greater_equal<>() ) != _levelWords.end()
+    ||  _fingerprints.size() != _size  ||  _fallback.size() > _size )
+    {
+      throw Format_Ex( "Saved perfect hash index is inconsistent" );
+    }
+
+    rank();
+    if( _ranks.back() + _fallback.size() != _size )           throw Format_Ex( "Saved perfect hash index is inconsistent" );
+  }
+
+
+
+
+  /*******************************************************************************
+  ** Queries
+  *******************************************************************************/
+  std::size_t PerfectHashIndex::find( std::string_view key ) const noexcept
+  {
+    auto hash = keyHash( key, _seed );
+    auto slot = slotOf( hash );
+
+    return slot != NOT_FOUND  &&  _fingerprints[slot] == fingerprint( hash ) ? slot : NOT_FOUND;
+  }
+
+
+
+  std::size_t PerfectHashIndex::size() const noexcept
+  { return _size; }
+
+
+
+  std::size_t PerfectHashIndex::indexBits() const noexcept
+  {
+    return ( _levelWords.size() + _bits.size() + _fallback.size() ) * 64  +  _ranks.size() * 32;
+  }
+
+
+
+
+  /*******************************************************************************
+  ** Persistence
+  *******************************************************************************/
+  void PerfectHashIndex::save( std::ostream & stream ) const
+  {
+    write( stream, FILE_SIGNATURE );
+    write( stream, _keysDigest    );
+    write( stream, _size          );
+    write( stream, _seed          );
+    write( stream, _levelWords    );
+    write( stream, _bits          );
+    write( stream, _fallback      );
+    write( stream, _fingerprints  );
+  }
+
+
+
+
+  /*******************************************************************************
+  ** Private implementation
+  *******************************************************************************/
+  std::size_t PerfectHashIndex::slotOf( std::uint64_t hash ) const noexcept
+  {
+    for( std::size_t level = 0; level + 1 < _levelWords.size(); ++level )
+    {
+      auto first = _levelWords[level];
+      auto bit   = first * 64  +  fastRange( levelHash( hash, level ), ( _levelWords[level + 1] - first ) * 64 );
+      auto word  = bit / 64;
+
+      if( ( _bits[word] >> bit % 64 & 1 ) != 0 )
+      {
+        std::size_t slot = _ranks[word / RANK_INTERVAL];
+        for( auto w = word / RANK_INTERVAL * RANK_INTERVAL; w < word; ++w ) slot += static_cast<std::size_t>( std::popcount( _bits[w] ) );
+        return slot + static_cast<std::size_t>( std::popcount( _bits[word] & ( ( 1ULL << bit % 64 ) - 1 ) ) );
+      }
+    }
+
+    if( auto fallback = std::lower_bound( _fallback.begin(), _fallback.end(), hash );  fallback != _fallback.end()  &&  *fallback == hash )
+    {
+      return _size - _fallback.size() + static_cast<std::size_t>( fallback - _fallback.begin() );
+    }
+
+    return NOT_FOUND;
+  }
+
+
+
+  void PerfectHashIndex::rank()
+  {
+    _ranks.clear();
+
+    std::uint32_t count = 0;
+    for( std::size_t word = 0; word < _bits.size(); ++word )
+    {
+      if( word % RANK_INTERVAL == 0 ) _ranks.push_back( count );
+      count += static_cast<std::uint32_t>( std::popcount( _bits[word] ) );
+    }
+    _ranks.push_back( count );                                                // total, one past the last sample
+  }
+}  // namespace Utilities
@@ -0,0 +1,70 @@
+/***********************************************************************************************************************************
+** Class PerfectHashIndex - A build once, read only, minimal perfect hash over a fixed set of unique keys (BBHash, Limasset et al.)
+**
+**      Utilities::PerfectHashIndex index( keys );          // maps each of keys.size() keys to its own slot in [0, keys.size())
+**      auto slot = index.find( "0001034359" );             // that key's slot, or NOT_FOUND
+**
+**  Keys are placed level by level into bit arrays GAMMA times as large as the keys remaining.  A key that lands alone in a bit is
+**  placed there, and the rest move on to the next level, so a lookup probes one bit per level until it finds a set one, then ranks
+**  it to get the slot.  With GAMMA = 2 about 60% of keys are placed at the first level, and the index costs about 3.5 bits per key.
+**
+**  Each slot also keeps an 8-bit fingerprint of its key, so all but 1 in 256 keys that aren't in the set are rejected without
+**  looking anywhere else.  The rest come back with some slot, so the caller must still compare keys to be certain.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uint32_t, uint8_t
+#include <iostream>
+#include <limits>       // numeric_limits
+#include <stdexcept>    // runtime_error
+#include <string_view>
+#include <vector>
+
+
+
+
+
+namespace Utilities
+{
+  class PerfectHashIndex
+  {
+    public:
+      struct Format_Ex : std::runtime_error { using runtime_error::runtime_error; };   // Thrown if a saved index can't be used
+
+      inline static constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+
+
+      // Constructors
+      PerfectHashIndex() = default;                                                      // an index of no keys
+      explicit PerfectHashIndex( std::vector<std::string_view> const & keys );           // keys must be unique
+      PerfectHashIndex( std::vector<std::string_view> const & keys, std::istream & saved );  // what save() wrote for these same keys,
+                                                                                         // throws Format_Ex if unreadable or for other keys
+      // Queries
+      std::size_t find     ( std::string_view key ) const noexcept;                      // key's slot, or NOT_FOUND if key definitely isn't one of the keys
+      std::size_t size     (                      ) const noexcept;                      // number of keys, and so of slots
+      std::size_t indexBits(                      ) const noexcept;                      // size of the hash function itself, fingerprints excluded
+
+      // Persistence
+      void save( std::ostream & stream ) const;                                          // binary, native byte order
+
+
+    private:
+      inline static constexpr double        GAMMA          = 2.0;                        // bits per remaining key at each level
+      inline static constexpr std::size_t   MAX_LEVELS     = 32;                         // keys still unplaced after this many go to _fallback
+      inline static constexpr std::size_t   RANK_INTERVAL  = 8;                          // words (512 bits) between rank samples
+      inline static constexpr std::uint64_t FILE_SIGNATURE = 0x3148'504D'4B4F'4F42ULL;   // "BOOKMPH1"
+
+      std::size_t slotOf( std::uint64_t hash ) const noexcept;                           // ignoring fingerprints
+      void        rank  ();                                                              // fills _ranks from _bits
+
+      std::uint64_t               _seed        = 0;         // for keyHash(), changed only if two keys' hashes collide
+      std::uint64_t               _keysDigest  = 0;         // identifies the set of keys, regardless of _seed
+      std::size_t                 _size        = 0;
+      std::vector<std::size_t>    _levelWords;              // offset of each level in _bits, plus one past the last
+      std::vector<std::uint64_t>  _bits;                    // every level's bits, each level starting on a word boundary
+      std::vector<std::uint32_t>  _ranks;                   // number of set bits before every RANK_INTERVAL'th word
+      std::vector<std::uint64_t>  _fallback;                // hashes of the keys no level placed, sorted, they take the last slots
+      std::vector<std::uint8_t>   _fingerprints;            // one per slot
+  };
+}  // namespace Utilities
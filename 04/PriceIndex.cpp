@@ -0,0 +1,199 @@
+#include <algorithm>    // lower_bound(), upper_bound(), stable_sort(), min(), max()
+#include <cstddef>      // size_t
+#include <cstdint>      // int32_t, int64_t, uint32_t
+#include <cstring>      // memcpy()
+#include <limits>       // numeric_limits
+#include <numeric>      // iota()
+#include <span>
+#include <stdexcept>    // invalid_argument
+#include <utility>      // move(), pair
+#include <vector>
+
+#include "PriceIndex.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  // Looking up a record in a price range costs about this many times what scanning one does (measured:  ~18 ns against ~0.9 ns), so
+  // narrower ranges are looked up and wider ones scanned
+  constexpr std::size_t SCAN_COST_RATIO = 20;
+
+  #if defined( __GNUC__ ) || defined( __clang__ )
+    using Int32x4  = std::int32_t  __attribute__(( vector_size( 16 ) ));        // the portable width:  SSE2 and NEON both have it
+    using UInt32x4 = std::uint32_t __attribute__(( vector_size( 16 ) ));
+  #endif
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Utilities
+{
+  PriceIndex::PriceIndex( std::vector<Cents> prices, std::vector<Group> groups )
+    : _prices( std::move( prices ) ), _groups( std::move( groups ) )
+  {
+    if( _prices.size() != _groups.size() )                            throw std::invalid_argument( "Every record needs both a price and a group" );
+    if( _prices.size() >= std::numeric_limits<Record>::max() )        throw std::invalid_argument( "Too many records for a price index" );
+
+    _byPrice.resize( _prices.size() );
+    std::iota( _byPrice.begin(), _byPrice.end(), Record{ 0 } );
+    std::stable_sort( _byPrice.begin(), _byPrice.end(), [this]( Record lhs, Record rhs ) noexcept { return _prices[lhs] < _prices[rhs]; } );
+
+    // A scan totals each lane in 32 bits for as many records as can't overflow it, then adds that to the 64-bit total
+    std::int64_t largest = 1;
+    for( auto price : _prices ) largest = std::max( largest, price < 0 ? -std::int64_t{ price } : std::int64_t{ price } );
+    _scanBlock = 4 * std::max<std::size_t>( 1, static_cast<std::size_t>( std::numeric_limits<Cents>::max() / largest ) );
+
+    _sortedPrices .reserve( _prices.size()     );
+    _runningTotals.reserve( _prices.size() + 1 );
+    _runningTotals.push_back( 0 );
+    for( auto record : _byPrice )
+    {
+      _sortedPrices .push_back( _prices[record] );
+      _runningTotals.push_back( _runningTotals.back() + _prices[record] );
+    }
+  }
+
+
+
+  PriceIndex::Summary PriceIndex::summarize( Cents low, Cents high ) const
+  {
+    auto [first, last] = range( low, high );
+    if( first == last )   return {};
+
+    return { last - first, _runningTotals[last] - _runningTotals[first] };
+  }
+
+
+
+  PriceIndex::Summary PriceIndex::summarize( Cents low, Cents high, Group firstGroup, Group lastGroup ) const
+  {
+    if( firstGroup >= lastGroup )   return {};
+
+    auto [first, last] = range( low, high );
+    if( ( last - first ) * SCAN_COST_RATIO < _prices.size() )   return lookUp( first, last, firstGroup, lastGroup );
+    return scan( low, high, firstGroup, lastGroup );
+  }
+
+
+
+  std::span<const PriceIndex::Record> PriceIndex::pricedBetween( Cents low, Cents high ) const
+  {
+    auto [first, last] = range( low, high );
+    return std::span( _byPrice ).subspan( first, last - first );
+  }
+
+
+
+  std::size_t PriceIndex::bytes() const noexcept
+  {
+    return _prices       .capacity() * sizeof( Cents        )
+         + _groups       .capacity() * sizeof( Group        )
+         + _sortedPrices .capacity() * sizeof( Cents        )
+         + _byPrice      .capacity() * sizeof( Record       )
+         + _runningTotals.capacity() * sizeof( std::int64_t );
+  }
+
+
+
+  void PriceIndex::renumber( std::vector<Record> const & newNumbers )
+  {
+    std::vector<Cents> prices( _prices.size() );
+    std::vector<Group> groups( _groups.size() );
+    for( std::size_t record = 0; record < _prices.size(); ++record )
+    {
+      prices[newNumbers[record]] = _prices[record];
+      groups[newNumbers[record]] = _groups[record];
+    }
+    _prices = std::move( prices );
+    _groups = std::move( groups );
+
+    for( auto & record : _byPrice ) record = newNumbers[record];
+  }
+
+
+
+  std::pair<std::size_t, std::size_t> PriceIndex::range( Cents low, Cents high ) const noexcept
+  {
+    if( low > high )   return { 0, 0 };
+
+    auto first = std::lower_bound( _sortedPrices.begin(), _sortedPrices.end(), low  );
+    auto last  = std::upper_bound( first,                 _sortedPrices.end(), high );
+    return { static_cast<std::size_t>( first - _sortedPrices.begin() ), static_cast<std::size_t>( last - _sortedPrices.begin() ) };
+  }
+
+
+
+  PriceIndex::Summary PriceIndex::lookUp( std::size_t first, std::size_t last, Group firstGroup, Group lastGroup ) const noexcept
+  {
+    Summary summary;
+    for( auto i = first; i < last; ++i )
+    {
+      auto group = _groups[_byPrice[i]];
+      if( group < firstGroup  ||  group >= lastGroup )   continue;
+
+      ++summary.count;
+      summary.total += _sortedPrices[i];
+    }
+    return summary;
+  }
+
+
+
+  PriceIndex::Summary PriceIndex::scan( Cents low, Cents high, Group firstGroup, Group lastGroup ) const noexcept
+  {
+    // Each range check is one unsigned comparison:  values below the start of the range wrap around to above its width
+    auto priceWidth = static_cast<std::uint32_t>( high ) - static_cast<std::uint32_t>( low );
+    auto groupWidth = lastGroup - firstGroup - 1;
+
+    Summary     summary;
+    std::size_t record = 0;
+    #if defined( __GNUC__ ) || defined( __clang__ )
+      // Four records at a time, and no branches:  a comparison makes each lane all ones (-1) or all zeros, so subtracting the
+      // combined mask counts the records in range and ANDing with it keeps only their prices
+      auto vectorEnd = _prices.size() - _prices.size() % 4;
+      while( record < vectorEnd )
+      {
+        auto    blockEnd = std::min( vectorEnd, record + _scanBlock );
+        Int32x4 counts   = {};
+        Int32x4 totals   = {};
+        for( ; record < blockEnd; record += 4 )
+        {
+          Int32x4  price;
+          UInt32x4 unsignedPrice, group;
+          std::memcpy( &price,         &_prices[record], sizeof( price ) );
+          std::memcpy( &unsignedPrice, &_prices[record], sizeof( price ) );
+          std::memcpy( &group,         &_groups[record], sizeof( group ) );
+
+          Int32x4 in = ( unsignedPrice - static_cast<std::uint32_t>( low ) <= priceWidth )  &  ( group - firstGroup <= groupWidth );
+          counts -= in;
+          totals += price & in;
+        }
+
+        for( int lane = 0; lane < 4; ++lane )
+        {
+          summary.count += static_cast<std::size_t>( counts[lane] );
+          summary.total += totals[lane];
+        }
+      }
+    #endif
+
+    for( ; record < _prices.size(); ++record )                                      // the rest, or all if there are no vectors
+    {
+      if( static_cast<std::uint32_t>( _prices[record] ) - static_cast<std::uint32_t>( low ) <= priceWidth  &&  _groups[record] - firstGroup <= groupWidth )
+      {
+        ++summary.count;
+        summary.total += _prices[record];
+      }
+    }
+
+    return summary;
+  }
+}  // namespace Utilities
@@ -0,0 +1,70 @@
+/***********************************************************************************************************************************
+** Class PriceIndex - A build once, read only, columnar index of prices for counting and totaling records by price range
+**
+**      Utilities::PriceIndex prices( centsOfEachRecord, groupOfEachRecord );     // a group is any id, an author's say
+**      auto summary = prices.summarize( 10'00, 20'00 );                           // records priced $10.00 through $20.00
+**      auto some    = prices.summarize( 10'00, 20'00, firstGroup, lastGroup );    //   and in groups [firstGroup, lastGroup)
+**
+**  Prices are kept twice.  A column of each record's price, next to a column of its group, is scanned start to finish a vector's
+**  worth of records at a time with no branches, which keeps up with memory.  The same prices sorted, with their running totals,
+**  answer a range without a group in two binary searches, and a narrow range with a group by looking at only the records in it.
+**
+**  Prices are whole cents so they sum exactly.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // int32_t, int64_t, uint32_t
+#include <span>
+#include <utility>      // pair
+#include <vector>
+
+
+
+
+
+namespace Utilities
+{
+  class PriceIndex
+  {
+    public:
+      using Record = std::uint32_t;                                                        // a record's number
+      using Group  = std::uint32_t;
+      using Cents  = std::int32_t;
+
+      struct Summary
+      {
+        std::size_t  count = 0;
+        std::int64_t total = 0;                                                            // in cents
+      };
+
+
+      // Constructors
+      PriceIndex() = default;                                                              // an index of no records
+      PriceIndex( std::vector<Cents> prices, std::vector<Group> groups );                  // record i's price and group, the same number of each
+
+      // Queries                                                                           // Ranges are inclusive, [low, high]
+      Summary                 summarize    ( Cents low, Cents high                                 ) const;
+      Summary                 summarize    ( Cents low, Cents high, Group firstGroup, Group lastGroup ) const;   // only groups [firstGroup, lastGroup)
+      std::span<const Record> pricedBetween( Cents low, Cents high                                 ) const;   // cheapest first
+      std::size_t             bytes        (                                                       ) const noexcept;
+
+      // Modifiers
+      void renumber( std::vector<Record> const & newNumbers );                             // record i is now record newNumbers[i]
+
+
+    private:
+      std::pair<std::size_t, std::size_t> range( Cents low, Cents high ) const noexcept;                          // positions in _sortedPrices
+
+      Summary lookUp( std::size_t first, std::size_t last, Group firstGroup, Group lastGroup ) const noexcept;     // only the records in range
+      Summary scan  ( Cents       low,   Cents       high, Group firstGroup, Group lastGroup ) const noexcept;     // every record
+
+      std::vector<Cents>        _prices;                                                   // by record
+      std::vector<Group>        _groups;                                                   // by record
+      std::size_t               _scanBlock = 0;                                            // records scanned before 32-bit lane totals could overflow
+
+      std::vector<Cents>        _sortedPrices;                                             // ascending,
+      std::vector<Record>       _byPrice;                                                  // the record of each,
+      std::vector<std::int64_t> _runningTotals;                                            // and the total of all before each (and one past the end)
+  };
+}  // namespace Utilities
@@ -0,0 +1,72 @@
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <string>     // to_string()
+
+#include "CheckResults.hpp"
+#include "BloomFilter.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class BloomFilterRegressionTest
+  {
+    public:
+      BloomFilterRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_bloomFilter_tests;
+
+
+
+
+  void BloomFilterRegressionTest::tests()
+  {
+    constexpr std::size_t KEYS = 100'000;
+
+    Utilities::BloomFilter filter( KEYS );
+    for( std::size_t i = 0; i < KEYS; ++i ) filter.insert( "978" + std::to_string( 1'000'000'000 + i * 7 ) );
+
+    std::size_t found = 0, falsePositives = 0;
+    for( std::size_t i = 0; i < KEYS; ++i )
+    {
+      if( filter.mayContain( "978" + std::to_string( 1'000'000'000 + i * 7 ) ) ) ++found;
+      if( filter.mayContain( "979" + std::to_string( 1'000'000'000 + i * 7 ) ) ) ++falsePositives;
+    }
+
+    affirm.is_equal       ( "Inserted keys - always maybe present",        KEYS,       found                 );
+    affirm.is_greater_than( "Other keys - about 1% false positives",       KEYS / 50,  falsePositives        );
+    affirm.is_equal       ( "Size - 10 bits per key, in whole cache lines", 125'056U,  filter.bytes()        );
+
+    Utilities::BloomFilter empty;
+    affirm.is_true        ( "Empty - nothing present",                     !empty.mayContain( "0001034359" ) );
+  }
+
+
+
+  BloomFilterRegressionTest::BloomFilterRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nBloom Filter Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class BloomFilter\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
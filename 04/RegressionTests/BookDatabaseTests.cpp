@@ -1,11 +1,15 @@
 #include <cmath>      // abs()
+#include <cstddef>    // size_t
 #include <cstdlib>    // exit()
 #include <exception>
 #include <filesystem> // exists()
+#include <functional> // less
 #include <iomanip>    // setprecision()
 #include <iostream>   // boolalpha(), showpoint(), fixed()
 #include <sstream>
+#include <stdexcept>  // invalid_argument
 #include <string>     // to_string()
+#include <utility>    // pair
 
 #include "CheckResults.hpp"
 #include "BookDatabase.hpp"
@@ -42,6 +46,30 @@ namespace  // anonymous
 
     affirm.is_equal( "Database construction - Expected size", expectedSize, db.size() );
 
+    {
+      // What the catalog took before, as a std::map<std::string, Book>:  each Book in a tree node, with three links, a colour, and
+      // a copy of its ISBN, plus the heap buffers of those strings too long to fit inside them
+      auto heapBytes = []( std::string const & text ) noexcept -> std::size_t
+      {
+        auto inside  = reinterpret_cast<char const *>( &text );
+        bool isShort = !std::less<>{}( text.data(), inside )  &&  std::less<>{}( text.data(), inside + sizeof( text ) );
+        return isShort ? 0 : text.capacity() + 1;
+      };
+
+      constexpr std::size_t nodeBytes = 4 * sizeof( void * ) + sizeof( std::pair<std::string const, Book> );
+
+      std::size_t books     = 0;
+      std::size_t bookBytes = 0;
+      for( Book const book : db.pricedBetween( -1'000'000'000.0, 1'000'000'000.0 ) )
+      {
+        ++books;
+        bookBytes += nodeBytes + 2 * heapBytes( book.isbn() ) + heapBytes( book.title() ) + heapBytes( book.author() );
+      }
+
+      affirm.is_equal( "Database construction - every Book priced",                         db.size(), books );
+      affirm.is_true ( "Database construction - catalog less than half the Books' footprint", db.catalogBytes() * 2 < bookBytes );
+    }
+
     if( auto p = db.find( "0001034359" ); p == nullptr )
     {
       affirm.is_not_equal( "Database query - existing book should have been found, but it wasn't", nullptr, p );
@@ -63,12 +91,101 @@ namespace  // anonymous
 
       // Now, put it back how you found it
       *p = control;
+      affirm.is_equal( "Database query - replaced book still located", control, *db.find( "0001034359" ) );
+
+      try
+      {
+        *p = Book( control.title(), control.author(), "--------------", control.price() );
+        affirm.is_true( "Database query - replacing a book with another ISBN rejected", false );
+      }
+      catch( std::invalid_argument const & )
+      {
+        affirm.is_true( "Database query - replacing a book with another ISBN rejected", db.find( "0001034359" ) != nullptr  &&  *db.find( "0001034359" ) == control );
+      }
+
+      Book copy = *p;
+      p->price( 1.23 );
+      affirm.is_true( "Database query - a copy is its own Book", copy == control  &&  db.find( "0001034359" )->price() == 1.23 );
+      p->price( control.price() );
     }
 
     {
       auto book = db.find( "--------------" );
       affirm.is_equal( "Database query - non-existing book found when it shouldn't have been", nullptr, book );
     }
+
+    {
+      auto before = db.size();
+      db.useIndex( BookDatabase::Index::Eytzinger );
+      auto book = db.find( "0001034359" );
+      affirm.is_true ( "Sorted index - existing book located",     book != nullptr  &&  book->author() == "Hans Christian Andersen" );
+      affirm.is_equal( "Sorted index - non-existing book rejected", nullptr, db.find( "--------------" ) );
+      affirm.is_equal( "Sorted index - size unchanged",             before,       db.size() );
+
+      db.useIndex( BookDatabase::Index::PerfectHash );
+      book = db.find( "0001034359" );
+      affirm.is_true ( "Perfect hash index - existing book located again", book != nullptr  &&  book->author() == "Hans Christian Andersen" );
+    }
+
+    {
+      auto byAuthor = db.findByAuthor( "hans christian  ANDERSEN" );
+      auto byTitle  = db.findByTitle ( "Tales of Hans Christian Andersen; read by Michael Redgrave (1st edition)" );
+      affirm.is_true( "Secondary index - found by author", !byAuthor.empty()  &&  byAuthor[0].isbn() == "0001034359" );
+      affirm.is_true( "Secondary index - found by title",  byTitle.size() == 1  &&  byTitle[0].isbn() == "0001034359" );
+      affirm.is_true( "Secondary index - unknown author",  db.findByAuthor( "Nobody Anyone Ever Heard Of" ).empty()  );
+
+      auto completions = db.completeTitle( "TALES of hans", 3 );
+      affirm.is_true( "Title completion - found by prefix", !completions.empty()  &&  completions[0][0].isbn() == "0001034359" );
+      affirm.is_true( "Title completion - at most count",   db.completeTitle( "", 3 ).size() <= 3 );
+
+      auto misspelled = db.findFuzzyTitle( "Tales of Hans Christain Andersen read by Michael Redgrave 1st edition" );
+      affirm.is_true( "Fuzzy match - title despite a typo",  !misspelled.empty()  &&  misspelled[0][0].isbn() == "0001034359" );
+      auto misspelledAuthor = db.findFuzzyAuthor( "Hans Christian Andresen", 2, 1 );
+      affirm.is_true( "Fuzzy match - author despite a typo", misspelledAuthor.size() == 1  &&  misspelledAuthor[0][0].author() == "Hans Christian Andersen" );
+
+      auto byPriceAndAuthor = db.priceSummary( 99.92, 99.92, "hans christian" );
+      auto byPrice          = db.priceSummary( 99.92, 99.92 );
+      affirm.is_true( "Price summary - by price and author prefix", byPriceAndAuthor.count >= 1  &&  byPriceAndAuthor.count <= byPrice.count );
+      affirm.is_true( "Price summary - totaled to the cent",        byPrice.total == Money( 99.92 ) * static_cast<Money::Cents>( byPrice.count ) );
+      affirm.is_equal( "Price summary - unknown author",            0U, db.priceSummary( 0.0, 1'000'000.0, "Nobody Anyone Ever Heard Of" ).count );
+
+      auto cheapest = db.pricedBetween( 10.0, 20.0 );
+      bool ordered  = cheapest.size() == db.priceSummary( 10.0, 20.0 ).count;
+      for( std::size_t i = 1; i < cheapest.size(); ++i ) ordered = ordered  &&  cheapest[i - 1].price() <= cheapest[i].price();
+      affirm.is_true( "Price index - cheapest first", ordered );
+
+      db.useIndex( BookDatabase::Index::Eytzinger );
+      affirm.is_true( "Price index - follows the Books when rearranged", db.priceSummary( 99.92, 99.92, "hans christian" ).count == byPriceAndAuthor.count
+                                                                         &&  ( db.pricedBetween( 99.92, 99.92 ).empty()  ||  db.pricedBetween( 99.92, 99.92 )[0].price() == 99.92 ) );
+      std::size_t found = 0;
+      for( Book const & match : db.findByAuthor( "Hans Christian Andersen" ) ) if( match.author() == "Hans Christian Andersen" ) ++found;
+      affirm.is_true( "Secondary index - follows the Books when rearranged", found > 0 );
+      db.useIndex( BookDatabase::Index::PerfectHash );
+
+      affirm.is_true( "Secondary index - memory reported", db.size() == 0  ||  db.secondaryIndexBytes() > 4 * db.size() );
+    }
+
+    if( auto p = db.find( "0001034359" ); p != nullptr )
+    {
+      Book control  = *p;
+      auto rawBytes = db.catalogBytes();
+
+      db.useStorage( BookDatabase::Storage::Compressed );
+      affirm.is_true ( "Compressed storage - smaller",        db.catalogBytes() < rawBytes );
+      affirm.is_equal( "Compressed storage - Book unchanged", control, *db.find( "0001034359" ) );
+
+      db.find( "0001034359" )->title( "Modified Title" ).author( "Hans Christian Andersen" );
+      affirm.is_true( "Compressed storage - changes stored",  db.find( "0001034359" )->title() == "Modified Title"
+                                                              &&  db.findByAuthor( "Hans Christian Andersen" )[0].author() == "Hans Christian Andersen" );
+      *db.find( "0001034359" ) = control;
+
+      db.useIndex( BookDatabase::Index::Eytzinger );
+      affirm.is_equal( "Compressed storage - follows the Books when rearranged", control, *db.find( "0001034359" ) );
+      db.useIndex( BookDatabase::Index::PerfectHash );
+
+      db.useStorage( BookDatabase::Storage::Raw );
+      affirm.is_equal( "Raw storage - Book restored", control, *db.find( "0001034359" ) );
+    }
   }
 
 
@@ -57,7 +57,7 @@ namespace  // anonymous
            b2.title() == "book's title"
         && b3.title() == "book's title" && b3.author() == "book's author"
         && b4.title() == "book's title" && b4.author() == "book's author" && b4.isbn() == "book's ISBN"
-        && b5.title() == "book's title" && b5.author() == "book's author" && b5.isbn() == "book's ISBN" && std::abs(b5.price() - 123.79) < EPSILON
+        && b5.title() == "book's title" && b5.author() == "book's author" && b5.isbn() == "book's ISBN" && b5.price() == 123.79
      );
 
     Book b6( b5 );
@@ -66,7 +66,7 @@ namespace  // anonymous
           b6.title()    ==  b5.title()
        && b6.author()   ==  b5.author()
        && b6.isbn()     ==  b5.isbn()
-       && std::abs(b6.price() - b5.price()) < EPSILON
+       && b6.price() == b5.price()
     );
 
     b6 = b4;
@@ -75,7 +75,7 @@ namespace  // anonymous
           b6.title()    ==  b4.title()
        && b6.author()   ==  b4.author()
        && b6.isbn()     ==  b4.isbn()
-       && std::abs(b6.price() - b4.price()) < EPSILON
+       && b6.price() == b4.price()
     );
   }
 
@@ -154,8 +154,8 @@ namespace  // anonymous
     affirm.is_not_equal( "Inequality Title test                      ", less, Book {"b1", "a1", "a1", 10.0} );
     affirm.is_not_equal( "Inequality Author test                     ", less, Book {"a1", "b1", "a1", 10.0} );
     affirm.is_not_equal( "Inequality ISBN test                       ", less, Book {"a1", "a1", "b1", 10.0} );
-    affirm.is_not_equal( "Inequality Price test - lower limit        ", less, Book {"a1", "a1", "a1", less.price() - ( 2 * EPSILON )} );
-    affirm.is_not_equal( "Inequality Price test - upper limit        ", less, Book {"a1", "a1", "a1", less.price() + ( 2 * EPSILON )} );
+    affirm.is_not_equal( "Inequality Price test - lower limit        ", less, Book {"a1", "a1", "a1", less.price() - Money::fromCents( 1 )} );
+    affirm.is_not_equal( "Inequality Price test - upper limit        ", less, Book {"a1", "a1", "a1", less.price() + Money::fromCents( 1 )} );
 
 
     auto check = [&]()
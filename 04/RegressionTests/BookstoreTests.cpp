@@ -50,6 +50,7 @@ namespace  // anonymous
       void test_2( const Bookstore::Inventory_DB & inventory );
       void test_3( const Bookstore::Inventory_DB & inventory );
       void test_4( const Bookstore::BooksSold    & soldBooks, const Bookstore::Inventory_DB & inventory );
+      void test_5( const Bookstore::InventoryView & view,     const Bookstore::Inventory_DB & inventory );
 
       void validate( const Bookstore::Inventory_DB & inventory, const Bookstore::Inventory_DB & pairs );
 
@@ -129,6 +130,25 @@ namespace  // anonymous
 
       theStore.reorderItems( booksSold );
       test_3( inventory );
+      test_5( theStore.inventoryView(), inventory );
+
+      // The Bloom filter of the inventory's ISBNs is built on construction and again by the first batch after the inventory's handed
+      // out, and not again until it's handed out again
+      affirm.is_equal( "Inventory filter - rebuilt once after the inventory is handed out", std::size_t{ 2 }, theStore.inventoryFilterBuilds() );
+
+      theStore.ringUpAllCustomers( {} );
+      Bookstore::BooksSold nothingSold;
+      theStore.reorderItems( nothingSold );
+      affirm.is_equal( "Inventory filter - not rebuilt while the inventory is unchanged",   std::size_t{ 2 }, theStore.inventoryFilterBuilds() );
+
+      theStore.getInventory()["0001034359"] = 5;                     // below the reorder threshold, so it's reordered if it's found
+      for( int batch = 0; batch < 2; ++batch )
+      {
+        Bookstore::BooksSold newBookSold = { "0001034359" };
+        theStore.reorderItems( newBookSold );
+      }
+      affirm.is_equal( "Inventory filter - rebuilt once after an ISBN is added",            std::size_t{ 3 }, theStore.inventoryFilterBuilds() );
+      affirm.is_equal( "Inventory filter - added ISBN reordered once",                      25U,              inventory.at( "0001034359" )   );
 
       std::clog << affirm << '\n';
     }
@@ -238,4 +258,20 @@ namespace  // anonymous
     affirm.is_true( "Items to reorder - content", expectedBooksToReorder == booksToReorder );
   }
 
+
+
+
+
+
+  void BookstoreRegressionTest::test_5( const Bookstore::InventoryView & view, const Bookstore::Inventory_DB & inventory )
+  {
+    affirm.is_equal( "Inventory view - size", inventory.size(), view.size() );
+
+    std::size_t matching = 0;
+    for( const auto & [isbn, quantity] : inventory ) if( auto found = view.find( isbn ); found != nullptr  &&  *found == quantity ) ++matching;
+    affirm.is_equal( "Inventory view - every quantity found",       inventory.size(), matching                    );
+    affirm.is_equal( "Inventory view - item no longer sold missing", nullptr,          view.find( "9802161748"   ) );
+    affirm.is_equal( "Inventory view - unknown item missing",        nullptr,          view.find( "54782169785"  ) );
+  }
+
 } // namespace
@@ -0,0 +1,77 @@
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <string>
+
+#include "CheckResults.hpp"
+#include "EditDistance.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class EditDistanceRegressionTest
+  {
+    public:
+      EditDistanceRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_editDistance_tests;
+
+
+
+
+  void EditDistanceRegressionTest::tests()
+  {
+    using Utilities::EditDistance;
+
+    EditDistance kitten( "kitten" );
+    affirm.is_equal( "Distance - identical",                   0U, kitten( "kitten",  5 ) );
+    affirm.is_equal( "Distance - substitutions and insertion", 3U, kitten( "sitting", 5 ) );
+    affirm.is_equal( "Distance - deletion",                    1U, kitten( "kiten",   5 ) );
+    affirm.is_equal( "Distance - from nothing",                6U, kitten( "",        9 ) );
+    affirm.is_equal( "Distance - to nothing",                  7U, EditDistance( "" )( "sitting", 9 ) );
+    affirm.is_equal( "Limit - farther than the limit",         3U, kitten( "sitting", 2 ) );
+    affirm.is_equal( "Limit - lengths too different",          3U, kitten( "kittens and cats", 2 ) );
+
+    // A pattern longer than one machine word is computed the slow way, but must agree
+    std::string longPattern( 100, 'a' ), longText( 100, 'a' );
+    longText[10] = 'b';
+    longText.erase( 50, 1 );
+    longText += "cc";
+    affirm.is_equal( "Long patterns - agree with the fast way", 3U, EditDistance( longPattern )( longText, 10 ) );
+    affirm.is_equal( "Long patterns - limit",                   2U, EditDistance( longPattern )( longText, 1  ) );
+
+    std::string wordPattern( 64, 'x' ), wordText( 64, 'x' );
+    wordText.front() = 'y';
+    wordText.back()  = 'y';
+    affirm.is_equal( "Full word patterns - distance", 2U, EditDistance( wordPattern )( wordText, 5 ) );
+  }
+
+
+
+  EditDistanceRegressionTest::EditDistanceRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nEdit Distance Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class EditDistance\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,96 @@
+#include <algorithm>  // shuffle()
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <random>     // default_random_engine
+#include <stdexcept>  // invalid_argument
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "EytzingerIndex.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class EytzingerIndexRegressionTest
+  {
+    public:
+      EytzingerIndexRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_eytzingerIndex_tests;
+
+
+
+
+  void EytzingerIndexRegressionTest::tests()
+  {
+    using Utilities::packKey;
+
+    affirm.is_true( "Packed keys - order by length",     *packKey( "0001"       ) < *packKey( "00010"      ) );
+    affirm.is_true( "Packed keys - order by content",    *packKey( "00010"      ) < *packKey( "0002"       ) );
+    affirm.is_true( "Packed keys - ISBN-10 vs ISBN-13",  *packKey( "9992761008" ) < *packKey( "9993023736" ) );
+    affirm.is_true( "Packed keys - too long",            !packKey( "12345678901234567" ).has_value()          );
+
+
+    constexpr std::size_t KEYS = 100'000;
+
+    std::vector<unsigned> keys;
+    for( unsigned i = 0; i < KEYS; ++i ) keys.push_back( 3 * i + 1 );
+    std::shuffle( keys.begin(), keys.end(), std::default_random_engine{} );
+
+    Utilities::EytzingerIndex<unsigned> index( keys );
+
+    std::vector<bool> taken( KEYS, false );
+    std::size_t       good = 0, strangers = 0;
+    for( auto key : keys )
+    {
+      auto slot = index.find( key );
+      if( slot < KEYS  &&  !taken[slot] ) { taken[slot] = true;  ++good; }
+
+      if( index.find( key - 1 ) != index.NOT_FOUND ) ++strangers;
+      if( index.find( key + 1 ) != index.NOT_FOUND ) ++strangers;
+    }
+    affirm.is_equal( "Construction - every key has a slot of its own", KEYS, good                  );
+    affirm.is_equal( "Misses - keys in between not found",             0U,   strangers             );
+    affirm.is_equal( "Misses - past the largest key not found",        index.NOT_FOUND, index.find( 3 * KEYS + 1 ) );
+
+    Utilities::EytzingerIndex<unsigned> empty( std::vector<unsigned>{} );
+    affirm.is_equal( "Empty - finds nothing", index.NOT_FOUND, empty.find( 1 ) );
+
+    try
+    {
+      Utilities::EytzingerIndex<unsigned> duplicates( std::vector<unsigned>{ 1, 2, 2 } );
+      affirm.is_true( "Construction - duplicate keys rejected", false );
+    }
+    catch( std::invalid_argument const & ) { affirm.is_true( "Construction - duplicate keys rejected", true ); }
+  }
+
+
+
+  EytzingerIndexRegressionTest::EytzingerIndexRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nEytzinger Index Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class EytzingerIndex\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,104 @@
+#include <algorithm>  // sort()
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <stdexcept>  // invalid_argument
+#include <string>     // to_string()
+#include <string_view>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "FrontCodedDictionary.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class FrontCodedDictionaryRegressionTest
+  {
+    public:
+      FrontCodedDictionaryRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_frontCodedDictionary_tests;
+
+
+
+
+  void FrontCodedDictionaryRegressionTest::tests()
+  {
+    using Utilities::FrontCodedDictionary;
+
+    std::vector<std::string> titles;
+    for( std::size_t i = 0; i < 10'000; ++i ) titles.push_back( "a history of volume " + std::to_string( i ) );
+    titles.push_back( "a history" );
+    titles.push_back( std::string( 200, 'z' ) );                       // longer than a one byte length
+    std::sort( titles.begin(), titles.end() );
+
+    std::vector<std::string_view> sorted( titles.begin(), titles.end() );
+    FrontCodedDictionary          dictionary( sorted );
+
+    std::size_t rawBytes = 0, correct = 0;
+    for( std::size_t rank = 0; rank < titles.size(); ++rank )
+    {
+      rawBytes += titles[rank].size();
+      if( dictionary.find( titles[rank] ) == rank  &&  dictionary.at( rank ) == titles[rank] ) ++correct;
+    }
+    affirm.is_equal       ( "Construction - every string found at its rank", titles.size(), correct            );
+    affirm.is_greater_than( "Construction - under half the raw bytes",        rawBytes / 2,  dictionary.bytes() );
+
+    affirm.is_equal( "Misses - not found",          FrontCodedDictionary::NOT_FOUND, dictionary.find( "a history of"  ) );
+    affirm.is_equal( "Misses - lower bound",        titles.size() - 1,               dictionary.lowerBound( "b"       ) );
+    affirm.is_equal( "Misses - past the end",       titles.size(),                   dictionary.lowerBound( "zzzz{"   ) );
+
+    {
+      auto [first, last] = dictionary.prefixRange( "a history of volume 12" );
+      bool correctRange  = last - first == 111;                        // 12, 120 - 129, and 1200 - 1299
+      for( auto rank = first; rank < last; ++rank ) correctRange = correctRange  &&  dictionary.at( rank ).starts_with( "a history of volume 12" );
+      affirm.is_true( "Prefixes - exactly the strings starting with the prefix", correctRange );
+
+      auto [none, alsoNone] = dictionary.prefixRange( "b" );
+      affirm.is_equal( "Prefixes - no strings", none, alsoNone );
+
+      auto [all, end] = dictionary.prefixRange( "" );
+      affirm.is_equal( "Prefixes - empty prefix is everything", titles.size(), end - all );
+    }
+
+    try
+    {
+      FrontCodedDictionary unsorted( std::vector<std::string_view>{ "b", "a" } );
+      affirm.is_true( "Construction - unsorted strings rejected", false );
+    }
+    catch( std::invalid_argument const & ) { affirm.is_true( "Construction - unsorted strings rejected", true ); }
+
+    FrontCodedDictionary empty;
+    affirm.is_equal( "Empty - finds nothing", FrontCodedDictionary::NOT_FOUND, empty.find( "" ) );
+  }
+
+
+
+  FrontCodedDictionaryRegressionTest::FrontCodedDictionaryRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nFront Coded Dictionary Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class FrontCodedDictionary\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
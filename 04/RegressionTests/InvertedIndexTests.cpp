@@ -0,0 +1,127 @@
+#include <algorithm>  // is_sorted()
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <string>     // to_string()
+#include <string_view>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "InvertedIndex.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class InvertedIndexRegressionTest
+  {
+    public:
+      InvertedIndexRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_invertedIndex_tests;
+
+
+
+
+  void InvertedIndexRegressionTest::tests()
+  {
+    using Utilities::InvertedIndex;
+
+    affirm.is_equal( "Normalize - case, punctuation, and spacing", std::string( "shadow maker 1st edition" ), InvertedIndex::normalize( "  Shadow maker \"1st edition)\" " ) );
+    affirm.is_equal( "Normalize - non-ASCII kept",                 std::string( "müller" ),                   InvertedIndex::normalize( "Müller"                            ) );
+    affirm.is_equal( "Normalize - nothing but punctuation",        std::string(),                             InvertedIndex::normalize( " ; -- "                            ) );
+
+
+    constexpr std::size_t RECORDS = 10'000, AUTHORS = 97;
+
+    std::vector<std::string> authors;
+    for( std::size_t i = 0; i < RECORDS; ++i ) authors.push_back( "Author " + std::to_string( i * 31 % AUTHORS ) );
+    std::vector<std::string_view> terms( authors.begin(), authors.end() );
+
+    InvertedIndex index( terms );
+    affirm.is_equal( "Construction - one dictionary entry per distinct term", AUTHORS, index.terms() );
+
+    {
+      std::size_t found = 0, correct = 0;
+      for( std::size_t a = 0; a < AUTHORS; ++a )
+      {
+        auto postings = index.find( "AUTHOR   " + std::to_string( a ) );
+        found += postings.size();
+        for( auto record : postings ) if( authors[record] == "Author " + std::to_string( a ) ) ++correct;
+        if( !std::is_sorted( postings.begin(), postings.end() ) ) --correct;
+      }
+      affirm.is_equal( "Queries - every record found once, by its normalized term", RECORDS, found   );
+      affirm.is_equal( "Queries - postings correct and ascending",                    RECORDS, correct );
+      affirm.is_true ( "Queries - unknown term finds nothing",  index.find( "Author 100" ).empty() );
+      affirm.is_true ( "Queries - prefix alone finds nothing",  index.find( "Author"     ).empty() );
+    }
+
+    {
+      auto completions = index.complete( "author 1", 5 );             // Author 1, Author 10 - 13
+      bool correct     = completions.size() == 5;
+      for( auto postings : completions ) correct = correct  &&  !postings.empty()  &&  authors[postings[0]].starts_with( "Author 1" );
+      affirm.is_true( "Completion - the first terms starting with the prefix", correct  &&  authors[completions[1][0]] == "Author 10" );
+      affirm.is_equal( "Completion - whole words only after a space", 1U, index.complete( "author 1 ", 5 ).size() );
+      affirm.is_equal( "Completion - partial words match too",         11U, index.complete( "author 1", 20 ).size() );
+      affirm.is_true ( "Completion - no terms",                       index.complete( "editor", 5 ).empty()     );
+    }
+
+    {
+      auto scanned = index.fuzzyFind( "Autor 42", 1, 5 );               // no trigrams indexed, every term checked
+      index.indexGrams();
+      auto indexed = index.fuzzyFind( "Autor 42", 1, 5 );
+      affirm.is_true ( "Fuzzy - closest term first",              !indexed.empty()  &&  authors[indexed[0][0]] == "Author 42" );
+      affirm.is_equal( "Fuzzy - trigram index finds the same",    scanned.size(), indexed.size() );
+      affirm.is_equal( "Fuzzy - only within the edit limit",      1U, index.fuzzyFind( "Author 4x2", 1, 5 ).size() );      // Author 42
+      affirm.is_equal( "Fuzzy - ranked and limited to count",     3U, index.fuzzyFind( "Author 4x2", 2, 3 ).size() );
+      affirm.is_true ( "Fuzzy - nothing close",                   index.fuzzyFind( "Editor 42 and friends", 2, 5 ).empty() );
+
+      auto shortTerm = index.fuzzyFind( "Autor 4", 2, 5 );              // too few trigrams to filter on
+      affirm.is_true ( "Fuzzy - short terms compared by length",  !shortTerm.empty()  &&  authors[shortTerm[0][0]] == "Author 4" );
+    }
+
+    {
+      std::vector<InvertedIndex::Posting> reversed( RECORDS );
+      for( std::size_t i = 0; i < RECORDS; ++i ) reversed[i] = static_cast<InvertedIndex::Posting>( RECORDS - 1 - i );
+      index.renumber( reversed );
+
+      auto postings = index.find( "Author 0" );
+      bool correct  = std::is_sorted( postings.begin(), postings.end() );
+      for( auto record : postings ) correct = correct  &&  authors[RECORDS - 1 - record] == "Author 0";
+      affirm.is_true( "Renumber - postings follow their records and stay ascending", correct  &&  !postings.empty() );
+    }
+
+    affirm.is_greater_than( "Memory - under 6 bytes per record", 6 * RECORDS, index.bytes() );
+
+    InvertedIndex empty;
+    affirm.is_true( "Empty - finds nothing", empty.find( "" ).empty() );
+  }
+
+
+
+  InvertedIndexRegressionTest::InvertedIndexRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nInverted Index Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class InvertedIndex\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,120 @@
+#include <charconv>     // to_chars(), from_chars()
+#include <cstddef>      // size_t
+#include <exception>
+#include <iomanip>      // setprecision()
+#include <iostream>     // boolalpha(), showpoint(), fixed()
+#include <limits>       // numeric_limits
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error> // errc
+
+#include "CheckResults.hpp"
+#include "Money.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class MoneyRegressionTest
+  {
+    public:
+      MoneyRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_money_tests;
+
+
+
+
+  void MoneyRegressionTest::tests()
+  {
+    auto written = []( Money value )
+    {
+      char buffer[Money::MAX_CHARS];
+      auto [end, error] = to_chars( buffer, buffer + Money::MAX_CHARS, value );
+      return error == std::errc{} ? std::string( buffer, end ) : std::string( "error" );
+    };
+
+    auto read = []( std::string_view text, Money expected )
+    {
+      Money value = Money::fromCents( 12345 );
+      auto [end, error] = from_chars( text.data(), text.data() + text.size(), value );
+      return error == std::errc{}  &&  end == text.data() + text.size()  &&  value == expected;
+    };
+
+    affirm.is_equal( "Conversion - nearest cent",          6565LL,  Money( 65.65  ).cents() );
+    affirm.is_equal( "Conversion - negative, nearest cent", -1999LL, Money( -19.99 ).cents() );
+    affirm.is_equal( "Conversion - back to dollars",        65.65,   Money( 65.65  ).dollars() );
+
+    // Ten cents added a million times drifts in a double (to 100000.0000013329), but not in Money
+    Money sum;
+    for( std::size_t i = 0; i < 1'000'000; ++i ) sum += 0.10;
+    affirm.is_equal( "Arithmetic - exact sums",         Money::fromCents( 10'000'000 ), sum );
+    affirm.is_equal( "Arithmetic - multiples",          Money( 29.97 ), Money( 9.99 ) * 3 );
+    affirm.is_equal( "Arithmetic - differences",        Money( -0.01 ), Money( 9.99 ) - Money( 10.00 ) );
+    affirm.is_true ( "Relational - ordered by amount",  Money( 9.99 ) < Money( 10.00 )  &&  -Money( 10.00 ) < Money( -9.99 ) );
+
+    affirm.is_equal( "to_chars - always two places",  std::string( "65.60"  ), written( 65.6  ) );
+    affirm.is_equal( "to_chars - under a dollar",     std::string( "0.07"   ), written( 0.07  ) );
+    affirm.is_equal( "to_chars - negative",           std::string( "-0.07"  ), written( -0.07 ) );
+    affirm.is_equal( "to_chars - zero",               std::string( "0.00"   ), written( {}    ) );
+    affirm.is_equal( "to_chars - smallest",           std::string( "-92233720368547758.08" ), written( Money::fromCents( std::numeric_limits<Money::Cents>::min() ) ) );
+
+    char small[3];
+    affirm.is_true( "to_chars - too small a buffer", to_chars( small, small + 3, Money( 100.00 ) ).ec == std::errc::value_too_large );
+
+    affirm.is_true( "from_chars - dollars and cents",      read( "118.07",  118.07 ) );
+    affirm.is_true( "from_chars - dollars only",           read( "118",     118.00 ) );
+    affirm.is_true( "from_chars - trailing point",         read( "118.",    118.00 ) );
+    affirm.is_true( "from_chars - one place",              read( "118.5",   118.50 ) );
+    affirm.is_true( "from_chars - cents only",             read( ".07",     0.07   ) );
+    affirm.is_true( "from_chars - rounds past the cents",  read( "0.995",   1.00   ) );
+    affirm.is_true( "from_chars - negative",               read( "-31.57",  -31.57 ) );
+    affirm.is_true( "from_chars - largest",                read( "92233720368547758.07", Money::fromCents( std::numeric_limits<Money::Cents>::max() ) ) );
+    affirm.is_true( "from_chars - smallest",               read( "-92233720368547758.08", Money::fromCents( std::numeric_limits<Money::Cents>::min() ) ) );
+
+    Money       unchanged = 1.00;
+    std::string huge      = "92233720368547758.08";
+    std::string none      = "-.";
+    affirm.is_true ( "from_chars - out of range", from_chars( huge.data(), huge.data() + huge.size(), unchanged ).ec == std::errc::result_out_of_range );
+    affirm.is_true ( "from_chars - not money",    from_chars( none.data(), none.data() + none.size(), unchanged ).ec == std::errc::invalid_argument   );
+    affirm.is_equal( "from_chars - left as it was on error", Money( 1.00 ), unchanged );
+
+    std::istringstream stream( "  65.65, 12.5x" );
+    Money first, second;
+    char  comma = 0;
+    stream >> first >> comma >> second;
+    affirm.is_true( "Extraction - stops at what isn't money", stream  &&  first == 65.65  &&  comma == ','  &&  second == 12.50  &&  stream.peek() == 'x' );
+
+    std::ostringstream out;
+    out << Money( 1234.5 );
+    affirm.is_equal( "Insertion - as to_chars writes", std::string( "1234.50" ), out.str() );
+  }
+
+
+
+  MoneyRegressionTest::MoneyRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nMoney Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class Money\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
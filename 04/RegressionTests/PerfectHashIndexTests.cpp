@@ -0,0 +1,121 @@
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <sstream>
+#include <string>     // to_string()
+#include <string_view>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "PerfectHashIndex.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class PerfectHashIndexRegressionTest
+  {
+    public:
+      PerfectHashIndexRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_perfectHashIndex_tests;
+
+
+
+
+  void PerfectHashIndexRegressionTest::tests()
+  {
+    constexpr std::size_t KEYS = 100'000;
+
+    std::vector<std::string> isbns, strangers;
+    for( std::size_t i = 0; i < KEYS; ++i )
+    {
+      isbns    .push_back( "978" + std::to_string( 1'000'000'000 + i * 7 ) );
+      strangers.push_back( "979" + std::to_string( 1'000'000'000 + i * 7 ) );
+    }
+    std::vector<std::string_view> keys( isbns.begin(), isbns.end() );
+
+    Utilities::PerfectHashIndex index( keys );
+
+
+    {
+      std::vector<bool> taken( KEYS, false );
+      std::size_t       good = 0;
+      for( auto key : keys )
+      {
+        auto slot = index.find( key );
+        if( slot < KEYS  &&  !taken[slot] ) { taken[slot] = true;  ++good; }
+      }
+      affirm.is_equal( "Construction - every key has a slot of its own", KEYS, good );
+      affirm.is_greater_than( "Construction - under 4 bits per key", 4.0, static_cast<double>( index.indexBits() ) / KEYS );
+    }
+
+    {
+      std::size_t falsePositives = 0;
+      for( auto const & stranger : strangers ) if( index.find( stranger ) != Utilities::PerfectHashIndex::NOT_FOUND ) ++falsePositives;
+      affirm.is_greater_than( "Misses - nearly all rejected by the fingerprints", KEYS / 100, falsePositives );
+    }
+
+    {
+      std::stringstream file;
+      index.save( file );
+
+      Utilities::PerfectHashIndex reloaded( keys, file );
+      std::size_t                 same = 0;
+      for( auto key : keys ) if( reloaded.find( key ) == index.find( key ) ) ++same;
+      affirm.is_equal( "Persistence - reloaded index places keys the same", KEYS, same );
+
+      std::vector<std::string_view> otherKeys( keys.begin(), keys.end() - 1 );
+      file.clear();
+      file.seekg( 0 );
+      try
+      {
+        Utilities::PerfectHashIndex stale( otherKeys, file );
+        affirm.is_true( "Persistence - index for other keys rejected", false );
+      }
+      catch( Utilities::PerfectHashIndex::Format_Ex const & ) { affirm.is_true( "Persistence - index for other keys rejected", true ); }
+
+      std::stringstream truncated( file.str().substr( 0, file.str().size() / 2 ) );
+      try
+      {
+        Utilities::PerfectHashIndex damaged( keys, truncated );
+        affirm.is_true( "Persistence - truncated index rejected", false );
+      }
+      catch( Utilities::PerfectHashIndex::Format_Ex const & ) { affirm.is_true( "Persistence - truncated index rejected", true ); }
+    }
+
+    {
+      Utilities::PerfectHashIndex empty( std::vector<std::string_view>{} );
+      affirm.is_equal( "Empty - size",          0U, empty.size() );
+      affirm.is_equal( "Empty - finds nothing", Utilities::PerfectHashIndex::NOT_FOUND, empty.find( isbns.front() ) );
+    }
+  }
+
+
+
+  PerfectHashIndexRegressionTest::PerfectHashIndexRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nPerfect Hash Index Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class PerfectHashIndex\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
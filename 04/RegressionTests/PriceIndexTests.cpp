@@ -0,0 +1,133 @@
+#include <cstddef>    // size_t
+#include <cstdint>    // int64_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <random>
+#include <stdexcept>  // invalid_argument
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "PriceIndex.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class PriceIndexRegressionTest
+  {
+    public:
+      PriceIndexRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_priceIndex_tests;
+
+
+
+
+  void PriceIndexRegressionTest::tests()
+  {
+    using Utilities::PriceIndex;
+
+    // Enough records that wide ranges are scanned, a vector at a time with a tail left over, and narrow ones looked up
+    std::mt19937                                 random( 131 );
+    std::uniform_int_distribution<PriceIndex::Cents> priceOf( -5'00, 200'00 );
+    std::uniform_int_distribution<PriceIndex::Group> groupOf( 0, 49 );
+
+    std::vector<PriceIndex::Cents> prices;
+    std::vector<PriceIndex::Group> groups;
+    for( std::size_t i = 0; i < 10'007; ++i )
+    {
+      prices.push_back( priceOf( random ) );
+      groups.push_back( groupOf( random ) );
+    }
+
+    auto bruteForce = [&]( PriceIndex::Cents low, PriceIndex::Cents high, PriceIndex::Group firstGroup, PriceIndex::Group lastGroup ) noexcept
+    {
+      PriceIndex::Summary summary;
+      for( std::size_t i = 0; i < prices.size(); ++i ) if( prices[i] >= low  &&  prices[i] <= high  &&  groups[i] >= firstGroup  &&  groups[i] < lastGroup )
+      {
+        ++summary.count;
+        summary.total += prices[i];
+      }
+      return summary;
+    };
+
+    auto agrees = [&]( PriceIndex const & index, PriceIndex::Cents low, PriceIndex::Cents high, PriceIndex::Group firstGroup, PriceIndex::Group lastGroup )
+    {
+      auto expected = bruteForce( low, high, firstGroup, lastGroup );
+      auto actual   = index.summarize( low, high, firstGroup, lastGroup );
+      return expected.count == actual.count  &&  expected.total == actual.total;
+    };
+
+    PriceIndex index( prices, groups );
+
+    auto everything = index.summarize( -5'00, 200'00 );
+    auto all        = bruteForce( -5'00, 200'00, 0, 50 );
+    affirm.is_equal( "Summary - every record counted", prices.size(), everything.count );
+    affirm.is_equal( "Summary - every price totaled",  all.total,     everything.total );
+    affirm.is_equal( "Summary - sorted totals agree",  bruteForce( 10'00, 20'00, 0, 50 ).total, index.summarize( 10'00, 20'00 ).total );
+    affirm.is_equal( "Summary - empty range",          0U,            index.summarize( 20'00, 10'00 ).count );
+
+    affirm.is_true( "Grouped - wide range, scanned",        agrees( index, 10'00, 150'00,  5,  45 ) );
+    affirm.is_true( "Grouped - narrow range, looked up",    agrees( index, 10'00,  10'50,  5,  45 ) );
+    affirm.is_true( "Grouped - negative prices",            agrees( index, -5'00,   5'00,  0,  50 ) );
+    affirm.is_true( "Grouped - a single group",             agrees( index,     0, 200'00, 17,  18 ) );
+    affirm.is_true( "Grouped - no groups",                  agrees( index,     0, 200'00, 18,  18 ) );
+    affirm.is_true( "Grouped - groups past the last",       agrees( index,     0, 200'00, 40, 100 ) );
+
+    auto cheapest = index.pricedBetween( 50'00, 60'00 );
+    bool ordered  = cheapest.size() == bruteForce( 50'00, 60'00, 0, 50 ).count;
+    for( std::size_t i = 0; i < cheapest.size(); ++i )
+    {
+      auto price = prices[cheapest[i]];
+      ordered = ordered  &&  price >= 50'00  &&  price <= 60'00  &&  ( i == 0  ||  prices[cheapest[i - 1]] <= price );
+    }
+    affirm.is_true( "Priced between - cheapest first", ordered );
+
+    // Reverse the records, as a rearranged database would
+    std::vector<PriceIndex::Record> reversed( prices.size() );
+    for( std::size_t i = 0; i < reversed.size(); ++i ) reversed[i] = static_cast<PriceIndex::Record>( reversed.size() - 1 - i );
+    index.renumber( reversed );
+    cheapest = index.pricedBetween( 50'00, 60'00 );
+    affirm.is_true( "Renumber - records follow", !cheapest.empty()  &&  prices[reversed.size() - 1 - cheapest[0]] >= 50'00 );
+    affirm.is_true( "Renumber - summaries unchanged", agrees( index, 10'00, 150'00, 5, 45 ) );
+
+    // Prices so large that a few of them overflow 32 bits
+    PriceIndex large( { 2'000'000'000, 2'000'000'000, 2'000'000'000, 2'000'000'000, 2'000'000'000, -2'000'000'000 }, { 0, 0, 0, 0, 0, 0 } );
+    affirm.is_equal( "Overflow - totaled in 64 bits", std::int64_t{ 8'000'000'000 }, large.summarize( -2'000'000'000, 2'000'000'000, 0, 1 ).total );
+
+    affirm.is_equal( "Empty - nothing counted", 0U, PriceIndex().summarize( 0, 100'00, 0, 10 ).count );
+
+    bool threw = false;
+    try { PriceIndex mismatched( { 1'00, 2'00 }, { 0 } ); }
+    catch( std::invalid_argument const & ) { threw = true; }
+    affirm.is_true( "Construction - prices and groups must pair up", threw );
+  }
+
+
+
+  PriceIndexRegressionTest::PriceIndexRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nPrice Index Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class PriceIndex\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,78 @@
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "StringArena.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class StringArenaRegressionTest
+  {
+    public:
+      StringArenaRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_stringArena_tests;
+
+
+
+
+  void StringArenaRegressionTest::tests()
+  {
+    using Utilities::StringArena;
+
+    StringArena strings;
+    auto empty = strings.append( ""                    );
+    auto title = strings.append( "Early aircraft"      );
+    auto name  = strings.append( "Maurice F. Allward"  );
+    auto large = strings.append( std::string( 300, 'a' ) );         // takes two bytes to say how long it is
+
+    affirm.is_equal( "Strings - empty",                  std::string_view{},                       strings.at( empty ) );
+    affirm.is_equal( "Strings - each where it was put",  std::string_view( "Early aircraft"     ), strings.at( title ) );
+    affirm.is_equal( "Strings - neighbors unaffected",   std::string_view( "Maurice F. Allward" ), strings.at( name  ) );
+    affirm.is_equal( "Strings - long lengths",           std::string_view( std::string( 300, 'a' ) ), strings.at( large ) );
+
+    // Appending one of the arena's own strings, as changing a title to another Book's would, may move it mid-copy
+    std::vector<StringArena::Offset> copies;
+    for( std::size_t i = 0; i < 1'000; ++i ) copies.push_back( strings.append( strings.at( title ) ) );
+    bool allCopied = true;
+    for( auto copy : copies ) allCopied = allCopied  &&  strings.at( copy ) == "Early aircraft";
+    affirm.is_true( "Strings - its own strings appended again", allCopied );
+
+    strings.shrinkToFit();
+    affirm.is_true( "Memory - a byte of length per short string", strings.bytes() < 1'000 * ( 1 + 14 ) + 300 + 100 );
+  }
+
+
+
+  StringArenaRegressionTest::StringArenaRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nString Arena Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class StringArena\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,89 @@
+#include <cstddef>    // size_t
+#include <exception>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "SymbolTable.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class SymbolTableRegressionTest
+  {
+    public:
+      SymbolTableRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_symbolTable_tests;
+
+
+
+
+  void SymbolTableRegressionTest::tests()
+  {
+    using Utilities::SymbolTable;
+
+    std::vector<std::string> titles = { "Tales of Hans Christian Andersen (1st edition)",
+                                        "Shadow maker (1st edition)",
+                                        "The history of the Standard Oil Company (2nd edition)",
+                                        "Early aircraft",
+                                        "The Adventures of Tom Sawyer (1st edition)" };
+    std::vector<std::string_view> sample;
+    for( std::size_t i = 0; i < 20; ++i ) for( auto const & title : titles ) sample.push_back( title );
+
+    SymbolTable table( sample );
+    affirm.is_true( "Learning - at most 255 symbols", table.size() > 0  &&  table.size() <= 255 );
+
+    bool        allRestored = true;
+    std::size_t encoded = 0, plain = 0;
+    for( auto const & title : titles )
+    {
+      auto codes   = table.encode( title );
+      allRestored  = allRestored  &&  table.decode( codes ) == title;
+      encoded     += codes.size();
+      plain       += title.size();
+    }
+    affirm.is_true( "Encoding - decodes to the same string",      allRestored );
+    affirm.is_true( "Encoding - at most half as long as learned", encoded * 2 <= plain );
+
+    // Bytes not in any symbol, including the escape code's own, are escaped
+    std::string unseen = "\xff\x01 Zürich \xfe";
+    affirm.is_equal( "Encoding - unlearned bytes escaped", unseen,        table.decode( table.encode( unseen ) ) );
+    affirm.is_equal( "Encoding - empty",                   std::string{}, table.decode( table.encode( "" ) ) );
+
+    SymbolTable none;
+    affirm.is_equal( "No symbols - every byte escaped", 2 * titles[0].size(), none.encode( titles[0] ).size() );
+    affirm.is_equal( "No symbols - still decodes",      titles[0],            none.decode( none.encode( titles[0] ) ) );
+  }
+
+
+
+  SymbolTableRegressionTest::SymbolTableRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nSymbol Table Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class SymbolTable\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,93 @@
+#include <cstddef>    // size_t
+#include <exception>
+#include <filesystem> // temp_directory_path(), remove()
+#include <fstream>
+#include <iomanip>    // setprecision()
+#include <iostream>   // boolalpha(), showpoint(), fixed()
+#include <iterator>   // istreambuf_iterator
+#include <string>
+#include <thread>
+
+#include "CheckResults.hpp"
+#include "TraceTimer.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class TraceTimerRegressionTest
+  {
+    public:
+      TraceTimerRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_traceTimer_tests;
+
+
+
+
+  std::size_t occurrences( std::string const & text, std::string const & pattern )
+  {
+    std::size_t count = 0;
+    for( auto at = text.find( pattern ); at != std::string::npos; at = text.find( pattern, at + pattern.size() ) ) ++count;
+    return count;
+  }
+
+
+
+
+  void TraceTimerRegressionTest::tests()
+  {
+    auto filename = ( std::filesystem::temp_directory_path() / "TraceTimerRegressionTest.json" ).string();
+
+    { TRACE_SCOPE( "Before the session" ); }              // not recorded, no session yet
+
+    {
+      Utilities::TraceSession session( filename );
+
+      for( int i = 0; i < 3; ++i ) { TRACE_SCOPE( "Main thread" ); }
+      std::thread worker( [] { TRACE_SCOPE( "Worker \"thread\"" ); } );
+      worker.join();
+    }
+
+    { TRACE_SCOPE( "After the session" ); }               // not recorded, session is over
+
+    std::ifstream fin( filename );
+    std::string   trace( std::istreambuf_iterator<char>( fin ), {} );
+    fin.close();
+    std::filesystem::remove( filename );
+
+    affirm.is_true ( "Trace file - well formed",         trace.starts_with( "{\"traceEvents\":[" ) && trace.ends_with( "}}\n" ) );
+    affirm.is_equal( "Trace file - complete events",     4U, occurrences( trace, "\"ph\":\"X\""                     ) );
+    affirm.is_equal( "Trace file - one label per scope", 3U, occurrences( trace, "\"name\":\"Main thread\""         ) );
+    affirm.is_equal( "Trace file - escaped label",       1U, occurrences( trace, "\"name\":\"Worker \\\"thread\\\"\"" ) );
+    affirm.is_equal( "Trace file - outside the session", 0U, occurrences( trace, "the session"                      ) );
+    affirm.is_equal( "Trace file - nothing dropped",     1U, occurrences( trace, "\"droppedEvents\":0"              ) );
+  }
+
+
+
+  TraceTimerRegressionTest::TraceTimerRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nTrace Timer Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class TraceTimer\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
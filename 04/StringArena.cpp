@@ -0,0 +1,61 @@
+#include <cstddef>      // size_t
+#include <functional>   // less, less_equal
+#include <limits>       // numeric_limits
+#include <stdexcept>    // length_error
+#include <string>
+#include <string_view>
+
+#include "StringArena.hpp"
+
+
+
+
+
+namespace Utilities
+{
+  StringArena::Offset StringArena::append( std::string_view text )
+  {
+    // text may be one of this arena's own strings, which growing the buffer would move out from under it
+    if( std::less_equal<>()( _buffer.data(), text.data() )  &&  std::less<>()( text.data(), _buffer.data() + _buffer.size() ) )   return append( std::string( text ) );
+
+    // Lengths are written 7 bits per byte, low bits first, with the high bit set on every byte but the last
+    if( _buffer.size() + text.size() + 10 > std::numeric_limits<Offset>::max() )   throw std::length_error( "String arena is full" );
+
+    auto offset = static_cast<Offset>( _buffer.size() );
+    auto length = text.size();
+    for( ; length >= 0x80; length >>= 7 ) _buffer += static_cast<char>( 0x80 | ( length & 0x7F ) );
+    _buffer += static_cast<char>( length );
+    _buffer += text;
+    return offset;
+  }
+
+
+
+  void StringArena::reserve( std::size_t bytes )
+  { _buffer.reserve( bytes ); }
+
+
+
+  void StringArena::shrinkToFit()
+  { _buffer.shrink_to_fit(); }
+
+
+
+  std::string_view StringArena::at( Offset offset ) const noexcept
+  {
+    std::size_t length   = 0;
+    std::size_t position = offset;
+    for( unsigned shift = 0; ; shift += 7 )
+    {
+      auto byte = static_cast<unsigned char>( _buffer[position++] );
+      length   |= std::size_t{ byte & 0x7FU } << shift;
+      if( byte < 0x80 )   break;
+    }
+    return std::string_view( _buffer ).substr( position, length );
+  }
+
+
+
+  std::size_t StringArena::bytes() const noexcept
+  { return _buffer.capacity(); }
+}  // namespace Utilities
@@ -0,0 +1,43 @@
+/***********************************************************************************************************************************
+** Class StringArena - Many strings, stored end to end in one buffer and identified by where they start
+**
+**      Utilities::StringArena strings;
+**      auto title = strings.append( "Early aircraft" );                 // a 32-bit offset, a quarter the size of a std::string
+**      std::cout << strings.at( title );                                 // a string_view of it
+**
+**  A std::string is 32 bytes before its text, and text longer than 15 characters is a separate heap allocation with its own
+**  overhead.  Here each string costs its length, plus one byte holding that length for strings under 128 characters.  Strings are
+**  never removed or changed, only added, so views returned are valid until the next append() moves the buffer.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t
+#include <string>
+#include <string_view>
+
+
+
+
+namespace Utilities
+{
+  class StringArena
+  {
+    public:
+      using Offset = std::uint32_t;
+
+
+      // Modifiers
+      Offset append     ( std::string_view text  );                                      // throws length_error past 4 GiB of strings
+      void   reserve    ( std::size_t      bytes );
+      void   shrinkToFit(                        );
+
+      // Queries
+      std::string_view at   ( Offset offset ) const noexcept;                            // offset must be one append() returned
+      std::size_t      bytes(               ) const noexcept;                            // memory used by the arena
+
+
+    private:
+      std::string _buffer;                                                               // each string as (length, text)
+  };
+}  // namespace Utilities
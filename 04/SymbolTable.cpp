@@ -0,0 +1,180 @@
+#include <algorithm>    // sort(), min()
+#include <array>
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t, uint32_t, uint64_t
+#include <cstring>      // memcpy(), memcmp()
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SymbolTable.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  // Learning the table compresses the sample this many times, each time keeping the symbols and pairs of neighboring symbols that
+  // saved the most.  Symbols can double in length each time, so five is enough to reach the longest.
+  constexpr unsigned ROUNDS = 5;
+
+  // While learning, what was matched at each step is a token:  a symbol's code, or LITERAL plus a byte that matched no symbol
+  constexpr std::size_t LITERAL = 256;
+  constexpr std::size_t TOKENS  = 512;
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Utilities
+{
+  SymbolTable::SymbolTable( std::vector<std::string_view> const & sample )
+  {
+    for( unsigned round = 0; round < ROUNDS; ++round )
+    {
+      std::vector<std::uint32_t> singles( TOKENS ), pairs( TOKENS * TOKENS );
+      for( auto text : sample )
+      {
+        for( std::size_t i = 0, previous = TOKENS; i < text.size(); )
+        {
+          auto code  = longestMatch( text.substr( i ) );
+          auto token = code == ESCAPE ? LITERAL + static_cast<unsigned char>( text[i] ) : code;
+          i += code == ESCAPE ? 1 : _lengths[code];
+
+          ++singles[token];
+          if( previous != TOKENS ) ++pairs[previous * TOKENS + token];
+          previous = token;
+        }
+      }
+
+      auto textOf = [this]( std::size_t token )
+      {
+        if( token >= LITERAL )   return std::string( 1, static_cast<char>( token - LITERAL ) );
+        return std::string( _symbols[token].data(), _lengths[token] );
+      };
+
+      // A symbol saves about a byte for each byte of it every time it's used
+      struct Candidate
+      {
+        std::string   text;
+        std::uint64_t gain;
+      };
+
+      std::vector<Candidate> candidates;
+      for( std::size_t token = 0; token < TOKENS; ++token )
+      {
+        if( singles[token] == 0 )   continue;
+        auto text = textOf( token );
+        candidates.push_back( { text, std::uint64_t{ singles[token] } * text.size() } );
+
+        for( std::size_t next = 0; next < TOKENS; ++next )
+        {
+          auto count = pairs[token * TOKENS + next];
+          if( count == 0 )   continue;
+          auto joined = text + textOf( next );
+          if( joined.size() <= MAX_LENGTH )   candidates.push_back( { joined, std::uint64_t{ count } * joined.size() } );
+        }
+      }
+
+      // The same text can be a candidate twice (a pair this round that was already a symbol), so keep only its best
+      std::sort( candidates.begin(), candidates.end(), []( Candidate const & lhs, Candidate const & rhs ) noexcept
+                                                       { return lhs.text != rhs.text ? lhs.text < rhs.text : lhs.gain > rhs.gain; } );
+      candidates.erase( std::unique( candidates.begin(), candidates.end(), []( Candidate const & lhs, Candidate const & rhs ) noexcept
+                                                                          { return lhs.text == rhs.text; } ),
+                        candidates.end() );
+
+      auto kept = std::min( candidates.size(), MAX_SYMBOLS );
+      std::partial_sort( candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>( kept ), candidates.end(),
+                         []( Candidate const & lhs, Candidate const & rhs ) noexcept { return lhs.gain > rhs.gain; } );
+      candidates.resize( kept );
+
+      // Ordered by first byte, then longest first, so the first symbol that matches is the longest that does
+      std::sort( candidates.begin(), candidates.end(), []( Candidate const & lhs, Candidate const & rhs ) noexcept
+                                                       { return lhs.text[0] != rhs.text[0] ? static_cast<unsigned char>( lhs.text[0] ) < static_cast<unsigned char>( rhs.text[0] )
+                                                                                           : lhs.text.size() > rhs.text.size(); } );
+      _symbols   = {};
+      _lengths   = {};
+      _firstCode = {};
+      _size      = candidates.size();
+      for( std::size_t code = 0; code < _size; ++code )
+      {
+        std::memcpy( _symbols[code].data(), candidates[code].text.data(), candidates[code].text.size() );
+        _lengths[code] = static_cast<std::uint8_t>( candidates[code].text.size() );
+        ++_firstCode[static_cast<unsigned char>( candidates[code].text[0] ) + 1];
+      }
+      for( std::size_t byte = 1; byte < _firstCode.size(); ++byte ) _firstCode[byte] = static_cast<std::uint8_t>( _firstCode[byte] + _firstCode[byte - 1] );
+    }
+  }
+
+
+
+  std::string SymbolTable::encode( std::string_view text ) const
+  {
+    std::string codes;
+    codes.reserve( text.size() );
+    for( std::size_t i = 0; i < text.size(); )
+    {
+      auto code = longestMatch( text.substr( i ) );
+      if( code == ESCAPE )
+      {
+        codes += static_cast<char>( ESCAPE );
+        codes += text[i++];
+      }
+      else
+      {
+        codes += static_cast<char>( code );
+        i     += _lengths[code];
+      }
+    }
+    return codes;
+  }
+
+
+
+  std::string SymbolTable::decode( std::string_view codes ) const
+  {
+    // Every code writes all 8 bytes of its symbol, so there's room for 8 bytes per code
+    std::string text( codes.size() * MAX_LENGTH, '\0' );
+    auto        out = text.data();
+    for( std::size_t i = 0; i < codes.size(); ++i )
+    {
+      auto code = static_cast<unsigned char>( codes[i] );
+      if( code == ESCAPE )
+      {
+        *out++ = codes[++i];
+        continue;
+      }
+      std::memcpy( out, _symbols[code].data(), MAX_LENGTH );
+      out += _lengths[code];
+    }
+    text.resize( static_cast<std::size_t>( out - text.data() ) );
+    return text;
+  }
+
+
+
+  std::size_t SymbolTable::size() const noexcept
+  { return _size; }
+
+
+
+  std::size_t SymbolTable::bytes() const noexcept
+  { return sizeof( *this ); }
+
+
+
+  std::size_t SymbolTable::longestMatch( std::string_view text ) const noexcept
+  {
+    auto first = static_cast<unsigned char>( text[0] );
+    for( std::size_t code = _firstCode[first]; code < _firstCode[first + 1]; ++code )
+    {
+      if( _lengths[code] <= text.size()  &&  std::memcmp( _symbols[code].data(), text.data(), _lengths[code] ) == 0 )   return code;
+    }
+    return ESCAPE;
+  }
+}  // namespace Utilities
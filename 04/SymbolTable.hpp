@@ -0,0 +1,54 @@
+/***********************************************************************************************************************************
+** Class SymbolTable - Compresses short strings by replacing their common substrings with one byte codes (FSST)
+**
+**      Utilities::SymbolTable table( someTitles );                      // learns up to 255 substrings that shorten them the most
+**      auto codes = table.encode( "Tales of Hans Christian Andersen" ); // about half as long
+**      auto title = table.decode( codes );                              // the same string again
+**
+**  A symbol is 1 to 8 bytes.  Each code byte stands for a symbol, except ESCAPE, which says the next byte is only itself.  Unlike
+**  block compression, each string is encoded on its own, so any one can be decoded without the others:  a code at a time, copying
+**  all 8 bytes of its symbol and moving ahead by only its length.  The table is built as Boncz, Neumann, and Leis describe in
+**  "FSST: Fast Random Access String Compression" (VLDB 2020), though encoding here simply tries the symbols starting with each byte,
+**  longest first, rather than hashing.
+***********************************************************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+
+namespace Utilities
+{
+  class SymbolTable
+  {
+    public:
+      // Constructors
+      SymbolTable() = default;                                                           // no symbols, so every byte is escaped
+      explicit SymbolTable( std::vector<std::string_view> const & sample );              // symbols that would shorten sample most
+
+      // Queries
+      std::string encode( std::string_view text  ) const;
+      std::string decode( std::string_view codes ) const;                                // codes must be what encode() returned
+      std::size_t size  (                        ) const noexcept;                       // number of symbols
+      std::size_t bytes (                        ) const noexcept;                       // memory used by the table
+
+
+    private:
+      inline static constexpr std::size_t   MAX_SYMBOLS = 255;
+      inline static constexpr std::size_t   MAX_LENGTH  = 8;
+      inline static constexpr unsigned char ESCAPE      = 255;
+
+      std::size_t longestMatch( std::string_view text ) const noexcept;                  // code of the longest symbol text starts with,
+                                                                                         // or ESCAPE
+      std::array<std::array<char, MAX_LENGTH>, MAX_SYMBOLS> _symbols   = {};             // zero padded, in order of first byte then
+      std::array<std::uint8_t, MAX_SYMBOLS>                 _lengths   = {};             // longest first,
+      std::array<std::uint8_t, 257>                         _firstCode = {};             // so those starting with byte b are codes
+      std::size_t                                           _size      = 0;              // [_firstCode[b], _firstCode[b + 1])
+  };
+}  // namespace Utilities
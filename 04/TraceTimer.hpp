@@ -0,0 +1,287 @@
+/***********************************************************************************************************************************
+** Class TraceTimerType - A scoped timer for hot code paths.  Where TimerType formats and writes its message when destroyed,
+**                        TraceTimerType only records (label, start, duration) into a per-thread ring buffer.  It allocates
+**                        nothing and performs no I/O.  A TraceSession's background thread drains the rings and writes the
+**                        events to a file in Chrome's trace event format, viewable in chrome://tracing or https://ui.perfetto.dev
+**
+**      Utilities::TraceSession session( "trace.json" );   // begin tracing; the file is completed when session is destroyed
+**      ...
+**      {
+**        TRACE_SCOPE( "Load database" );                  // times the rest of the enclosing scope
+**        ...
+**      }
+**
+**  Outside a TraceSession's lifetime TRACE_SCOPE does nothing, not even read the clock.
+**
+***********************************************************************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>               // steady_clock, duration_cast<>(), milliseconds
+#include <condition_variable>
+#include <cstddef>              // size_t
+#include <cstdint>              // uint32_t, int64_t
+#include <deque>
+#include <fstream>
+#include <iomanip>              // setprecision()
+#include <memory>               // unique_ptr
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+
+
+
+namespace Utilities
+{
+  // One completed timing.  Times are in nanoseconds since the recording clock's epoch.
+  struct TraceEvent
+  {
+    std::uint32_t label    = 0;
+    std::uint32_t thread   = 0;
+    std::int64_t  start    = 0;
+    std::int64_t  duration = 0;
+  };
+
+
+
+
+  // A fixed capacity, single producer (the owning thread) single consumer (the flusher) queue.  When full, new events are dropped
+  // and counted rather than blocking the thread being traced.
+  template<std::size_t Capacity>
+  class TraceRing
+  {
+    public:
+      bool push( TraceEvent const & event ) noexcept
+      {
+        auto head = _head.load( std::memory_order_relaxed );
+        if( head - _tail.load( std::memory_order_acquire ) == Capacity )
+        {
+          _dropped.fetch_add( 1, std::memory_order_relaxed );
+          return false;
+        }
+
+        _events[head % Capacity] = event;
+        _head.store( head + 1, std::memory_order_release );
+        return true;
+      }
+
+      template<class Consumer>
+      std::size_t drain( Consumer && consume )
+      {
+        auto tail  = _tail.load( std::memory_order_relaxed );
+        auto head  = _head.load( std::memory_order_acquire );
+        auto count = head - tail;
+
+        for( ; tail != head; ++tail ) consume( _events[tail % Capacity] );
+        _tail.store( tail, std::memory_order_release );
+        return count;
+      }
+
+      std::size_t dropped() const noexcept
+      { return _dropped.load( std::memory_order_relaxed ); }
+
+
+    private:
+      std::array<TraceEvent, Capacity>      _events;
+      alignas( 64 ) std::atomic<std::size_t> _head    = 0;                // written only by the producer
+      alignas( 64 ) std::atomic<std::size_t> _tail    = 0;                // written only by the consumer
+      std::atomic<std::size_t>               _dropped = 0;
+  };
+
+
+
+
+  // Owns the trace file and the background thread that fills it.  At most one session should be alive at a time; events are
+  // recorded only while one is.
+  class TraceSession
+  {
+    public:
+      inline static constexpr std::size_t RING_CAPACITY = std::size_t{ 1 } << 14;      // events buffered per thread between flushes
+      using Ring = TraceRing<RING_CAPACITY>;
+
+      explicit TraceSession( std::string const & filename, std::chrono::milliseconds flushInterval = std::chrono::milliseconds{ 50 } )
+        : _file{ filename }, _flushInterval{ flushInterval }
+      {
+        _file << "{\"traceEvents\":[";
+        _flusher = std::thread( [this] { flushLoop(); } );
+        active().store( this, std::memory_order_release );
+      }
+
+      ~TraceSession() noexcept
+      {
+        active().store( nullptr, std::memory_order_release );
+        {
+          std::lock_guard lock( _stopMutex );
+          _stop = true;
+        }
+        _wakeUp.notify_one();
+        _flusher.join();
+
+        flush();                                                          // whatever arrived after the flusher's last pass
+        _file << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" << dropped() << "}}\n";
+      }
+
+      TraceSession            ( TraceSession const & ) = delete;
+      TraceSession & operator=( TraceSession const & ) = delete;
+
+
+      // Interns a label, returning its id.  Takes a lock, so call it once per call site (TRACE_SCOPE does), not per event.
+      static std::uint32_t label( std::string_view name )
+      {
+        auto & registry = state();
+        std::lock_guard lock( registry.mutex );
+
+        for( std::size_t i = 0; i < registry.labels.size(); ++i )   if( registry.labels[i] == name )   return static_cast<std::uint32_t>( i );
+        registry.labels.emplace_back( name );
+        return static_cast<std::uint32_t>( registry.labels.size() - 1 );
+      }
+
+      static bool enabled() noexcept
+      { return active().load( std::memory_order_relaxed ) != nullptr; }
+
+      // Hot path:  one ring buffer write, no locks, no allocation
+      static void record( std::uint32_t label, std::int64_t start, std::int64_t duration ) noexcept
+      {
+        auto & [ring, thread] = threadRing();
+        ring->push( { label, thread, start, duration } );
+      }
+
+
+    private:
+      struct Registry
+      {
+        std::mutex                         mutex;
+        std::deque<std::string>            labels;
+        std::vector<std::unique_ptr<Ring>> rings;                         // never released, so rings outlive the threads that fill them
+      };
+
+      struct ThreadRing
+      {
+        Ring *        ring;
+        std::uint32_t thread;
+      };
+
+      static Registry                    & state () { static Registry                     registry;         return registry; }
+      static std::atomic<TraceSession *> & active() { static std::atomic<TraceSession *>  session = nullptr; return session;  }
+
+      static ThreadRing & threadRing()                                    // registers the calling thread's ring on its first event
+      {
+        thread_local ThreadRing mine = []
+        {
+          auto & registry = state();
+          std::lock_guard lock( registry.mutex );
+          registry.rings.push_back( std::make_unique<Ring>() );
+          return ThreadRing{ registry.rings.back().get(), static_cast<std::uint32_t>( registry.rings.size() ) };
+        }();
+        return mine;
+      }
+
+
+      void flushLoop()
+      {
+        std::unique_lock lock( _stopMutex );
+        while( !_wakeUp.wait_for( lock, _flushInterval, [this] { return _stop; } ) )   flush();
+      }
+
+      void flush()
+      {
+        auto & registry = state();
+        std::lock_guard lock( registry.mutex );
+
+        for( std::size_t i = 0; i < registry.rings.size(); ++i )
+        {
+          registry.rings[i]->drain( [&]( TraceEvent const & event )
+          {
+            _file << ( _eventsWritten++ == 0 ? "\n" : ",\n" )
+                  << "{\"name\":\""  << escaped( registry.labels[event.label] ) << '"'
+                  << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+                  << std::fixed << std::setprecision( 3 )
+                  << ",\"ts\":"  << static_cast<double>( event.start    ) / 1'000.0      // trace event times are in microseconds
+                  << ",\"dur\":" << static_cast<double>( event.duration ) / 1'000.0
+                  << '}';
+          } );
+        }
+        _file.flush();
+      }
+
+      static std::size_t dropped()
+      {
+        auto & registry = state();
+        std::lock_guard lock( registry.mutex );
+
+        std::size_t total = 0;
+        for( auto const & ring : registry.rings ) total += ring->dropped();
+        return total;
+      }
+
+      static std::string escaped( std::string const & text )
+      {
+        std::string result;
+        for( char c : text )
+        {
+          if( c == '"' || c == '\\' ) result += '\\';
+          if( static_cast<unsigned char>( c ) >= 0x20 ) result += c;       // control characters have no business in a label
+        }
+        return result;
+      }
+
+
+      std::ofstream             _file;
+      std::chrono::milliseconds _flushInterval;
+      std::size_t               _eventsWritten = 0;
+
+      std::mutex                _stopMutex;
+      std::condition_variable   _wakeUp;
+      bool                      _stop = false;
+      std::thread               _flusher;                                 // physically last so everything it uses exists before it starts
+  };
+
+
+
+
+  template<typename Clock = std::chrono::steady_clock>
+  class TraceTimerType
+  {
+    public:
+      explicit TraceTimerType( std::uint32_t label ) noexcept
+        : _label{ label }, _enabled{ TraceSession::enabled() }
+      { if( _enabled ) _start = Clock::now(); }
+
+      ~TraceTimerType() noexcept
+      {
+        if( !_enabled ) return;
+
+        auto stop = Clock::now();
+        TraceSession::record( _label,
+                              std::chrono::duration_cast<std::chrono::nanoseconds>( _start.time_since_epoch() ).count(),
+                              std::chrono::duration_cast<std::chrono::nanoseconds>( stop - _start         ).count() );
+      }
+
+      TraceTimerType            ( TraceTimerType const & ) = delete;
+      TraceTimerType & operator=( TraceTimerType const & ) = delete;
+
+
+    private:
+      std::uint32_t              _label;
+      bool                       _enabled;
+      typename Clock::time_point _start;                                  // physically the last attribute so the clock starts after everything else
+  };
+
+  using TraceTimer = TraceTimerType<>;
+}  // namespace Utilities
+
+
+
+
+// A macro, because each use needs its own function-local static label id (interned once, on first pass) and a uniquely named timer
+// object living to the end of the enclosing scope.  Both names are made unique by pasting in the line number.
+#define UTILITIES_TRACE_CONCAT_( a, b )  a##b
+#define UTILITIES_TRACE_CONCAT( a, b )   UTILITIES_TRACE_CONCAT_( a, b )
+#define TRACE_SCOPE( name )                                                                                                         \
+  static const std::uint32_t UTILITIES_TRACE_CONCAT( traceLabel_, __LINE__ ) = Utilities::TraceSession::label( name );              \
+  Utilities::TraceTimer      UTILITIES_TRACE_CONCAT( traceTimer_, __LINE__ ){ UTILITIES_TRACE_CONCAT( traceLabel_, __LINE__ ) }
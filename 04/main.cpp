@@ -1,8 +1,11 @@
 #include <exception>
 #include <iomanip>      // setprecision()
 #include <iostream>     // cout, fixed(), showpoint()
+#include <memory>       // unique_ptr
+#include <string_view>
 
 #include "Bookstore.hpp"
+#include "TraceTimer.hpp"
 
 
 
@@ -10,12 +13,16 @@
 
 
 
-int main()
+int main( int argc, char * argv[] )
 {
   try
   {
     std::cout << std::fixed << std::setprecision( 2 ) << std::showpoint;
 
+    // "--trace [file]" records the database load and checkouts to a Chrome trace file (default trace.json) for chrome://tracing
+    std::unique_ptr<Utilities::TraceSession> trace;
+    if( argc > 1  &&  std::string_view( argv[1] ) == "--trace" )   trace = std::make_unique<Utilities::TraceSession>( argc > 2 ? argv[2] : "trace.json" );
+
 
     ///////////////////////// TO-DO (1) //////////////////////////////
       /// Create your bookstore
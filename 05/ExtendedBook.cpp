@@ -1,32 +1,17 @@
 #include <fstream>
+#include <functional>    // hash
 #include <iostream>
 #include <string>
-#include <locale>     // tolower()
+#include <vector>
 
 #include "ExtendedBook.hpp"
+#include "Sanitize.hpp"
 
 
 namespace
 {
-  // Non-member helper function
-  std::string sanitize( const std::string & word )
-  {
-    constexpr char bad_char[] = " \t\n\b\v_-\"'(){}+/*,=.!?:;";            // leading and trailing characters to be removed
-    static std::locale locality;
-
-    auto startIndex = word.find_first_not_of( bad_char );                  // start with the first non-bad character
-    if( startIndex == std::string::npos ) startIndex = word.size();        // if the word contains only bad characters ...
-
-    std::size_t count    = 0;                                              // assume the word contains only bad characters ...
-    auto        endIndex = word.find_last_not_of( bad_char );              // end with the first non-bad character
-
-    if( endIndex != std::string::npos ) count = endIndex - startIndex + 1; // number of characters to use in results
-
-    auto result = word.substr( startIndex, count );                        // strip the leading and trailing bad characters
-    for( auto & c : result ) c = std::tolower( c, locality );              // convert to lower case
-
-    return result;
-  }
+  // Initial frequency table reservation.  bucketStatistics() replays the table's construction, so both must agree on this.
+  constexpr std::size_t reserveWords = 1000;
 }    // namespace
 
 
@@ -62,7 +47,6 @@ ExtendedBook::ExtendedBook(std::string theTitle, std::string theAuthor, std::str
 {
   // Something something premature optimization is the root of all evil.
   // Hopefully, doing this will make C++ regrow the map less often.
-  const auto reserveWords = 1000;
   frequency.reserve(reserveWords);
 
   // Important: we std::moved the ISBN into the Book class, so we cannot use
@@ -148,3 +132,25 @@ std::size_t ExtendedBook::maxBucketSize() const {
   return maxBucketSize;
 }
 /////////////////////// END-TO-DO (5) ////////////////////////////
+
+
+
+
+std::vector<std::string> ExtendedBook::vocabulary() const {
+  std::vector<std::string> words;
+  words.reserve(frequency.size());
+
+  for (const auto& pair : frequency) {
+    words.push_back(pair.first);
+  }
+
+  return words;
+}
+
+
+
+HashDiagnostics::BucketStatistics ExtendedBook::bucketStatistics() const {
+  // Replaying the same number of insertions with the same hash function and the same initial reservation as the constructor
+  // reproduces the frequency table's bucket layout exactly, and is the only way to learn how many times it rehashed.
+  return HashDiagnostics::build<std::hash<std::string>>(vocabulary(), "std::hash", reserveWords);
+}
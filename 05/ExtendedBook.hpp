@@ -2,8 +2,10 @@
 #include <cstddef>                                                      // size_t
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Book.hpp"
+#include "HashDiagnostics.hpp"
 
 
 class ExtendedBook : public Book
@@ -22,6 +24,9 @@ class ExtendedBook : public Book
     std::string mostFrequentWord(                          ) const;     // Returns the most frequent word, or the empty string if the Book is empty.
     std::size_t maxBucketSize   (                          ) const;     // Returns the size of the hashtable's largest bucket. See the unordered_map's bucket interface at https://en.cppreference.com/w/cpp/container/unordered_map
 
+    std::vector<std::string>          vocabulary      () const;         // Returns the unique (sanitized) words, in no particular order
+    HashDiagnostics::BucketStatistics bucketStatistics() const;         // Returns the full bucket-size histogram, load factor, probe lengths, and rehash count
+
   private:
     ///////////////////////// TO-DO (1) //////////////////////////////
       /// The class should have a single member attribute, of type std::unordered_map which is the C++ Standard Library's
@@ -0,0 +1,63 @@
+#include <functional>    // hash
+#include <set>
+
+#include "HashDiagnostics.hpp"
+#include "HashFunctions.hpp"
+
+
+namespace HashDiagnostics
+{
+  std::vector<BucketStatistics> compareHashFunctions(const std::vector<std::string> & vocabulary, std::size_t reserve) {
+    return {
+      build<std::hash<std::string>> (vocabulary, "std::hash", reserve),
+      build<HashFunctions::Fnv1a>   (vocabulary, "FNV-1a",    reserve),
+      build<HashFunctions::WyHash>  (vocabulary, "wyhash",    reserve),
+      build<HashFunctions::Xxh64>   (vocabulary, "XXH64",     reserve),
+    };
+  }
+
+
+
+  std::ostream & writeSummaryCsv(std::ostream & stream, const std::vector<BucketStatistics> & results) {
+    stream << "Hash,Words,Buckets,Load Factor,Empty Buckets,Max Bucket Size,Rehashes,Expected Probe Length,Observed Probe Length\n";
+
+    for (const auto & stats : results) {
+      stream << stats.hashName            << ','
+             << stats.words               << ','
+             << stats.buckets             << ','
+             << stats.loadFactor          << ','
+             << stats.emptyBuckets        << ','
+             << stats.maxBucketSize       << ','
+             << stats.rehashes            << ','
+             << stats.expectedProbeLength << ','
+             << stats.observedProbeLength << '\n';
+    }
+
+    return stream;
+  }
+
+
+
+  std::ostream & writeHistogramCsv(std::ostream & stream, const std::vector<BucketStatistics> & results) {
+    // Not every hash function produces every bucket size, so collect the union of sizes first and fill the gaps with zeros.
+    std::set<std::size_t> sizes;
+    for (const auto & stats : results) {
+      for (const auto & [size, count] : stats.histogram) sizes.insert(size);
+    }
+
+    stream << "Bucket Size";
+    for (const auto & stats : results) stream << ',' << stats.hashName;
+    stream << '\n';
+
+    for (auto size : sizes) {
+      stream << size;
+      for (const auto & stats : results) {
+        auto it = stats.histogram.find(size);
+        stream << ',' << (it == stats.histogram.end() ? 0 : it->second);
+      }
+      stream << '\n';
+    }
+
+    return stream;
+  }
+}    // namespace HashDiagnostics
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>                                                      // size_t
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>                                                      // move()
+#include <vector>
+
+
+// Hash table quality diagnostics.  ExtendedBook::maxBucketSize() reports only the largest bucket; these report the whole
+// bucket-size distribution of a std::unordered_map, the probe lengths it implies, and how many times the table rehashed while
+// it was being built, so different hash functions can be compared on the same vocabulary.
+namespace HashDiagnostics
+{
+  struct BucketStatistics
+  {
+    std::string                        hashName;
+    std::size_t                        words               = 0;     // number of keys in the table
+    std::size_t                        buckets             = 0;     // bucket_count()
+    std::size_t                        emptyBuckets        = 0;
+    std::size_t                        maxBucketSize       = 0;     // same as ExtendedBook::maxBucketSize()
+    std::size_t                        rehashes            = 0;     // times bucket_count() changed while building the table
+    double                             loadFactor          = 0.0;
+    double                             expectedProbeLength = 0.0;   // average compares for a successful search under uniform hashing, 1 + load/2
+    double                             observedProbeLength = 0.0;   // average compares for a successful search as actually laid out
+    std::map<std::size_t, std::size_t> histogram;                   // bucket size -> number of buckets of that size
+  };
+
+
+  // Measures an existing table.  The rehash count can't be recovered after the fact, so it's reported as zero.
+  template<typename Table>
+  BucketStatistics measure( const Table & table, std::string hashName = "std::hash" )
+  {
+    BucketStatistics stats;
+    stats.hashName   = std::move( hashName );
+    stats.words      = table.size();
+    stats.buckets    = table.bucket_count();
+    stats.loadFactor = table.load_factor();
+
+    // A key that is k-th in its bucket's chain takes k compares to find, so a bucket of size s costs 1 + 2 + ... + s in total.
+    std::size_t totalProbes = 0;
+    for( std::size_t i = 0; i < table.bucket_count(); ++i )
+    {
+      auto size = table.bucket_size( i );
+
+      stats.histogram[size]++;
+      totalProbes += size * ( size + 1 ) / 2;
+      if( size > stats.maxBucketSize ) stats.maxBucketSize = size;
+    }
+
+    if( auto empty = stats.histogram.find( 0 ); empty != stats.histogram.end() ) stats.emptyBuckets = empty->second;
+    stats.expectedProbeLength = stats.words == 0 ? 0.0 : 1.0 + stats.loadFactor / 2.0;
+    stats.observedProbeLength = stats.words == 0 ? 0.0 : static_cast<double>( totalProbes ) / static_cast<double>( stats.words );
+
+    return stats;
+  }
+
+
+  // Builds a table of the vocabulary with the given hash function, the same way ExtendedBook builds its frequency table (reserve
+  // first, then insert word by word), counting rehashes along the way, and then measures it.
+  template<typename Hash>
+  BucketStatistics build( const std::vector<std::string> & vocabulary, std::string hashName, std::size_t reserve = 1000 )
+  {
+    std::unordered_map<std::string, std::size_t, Hash> table;
+    table.reserve( reserve );
+
+    std::size_t rehashes = 0;
+    for( const auto & word : vocabulary )
+    {
+      auto buckets = table.bucket_count();
+      table[word]++;
+      if( table.bucket_count() != buckets ) ++rehashes;
+    }
+
+    auto stats     = measure( table, std::move( hashName ) );
+    stats.rehashes = rehashes;
+    return stats;
+  }
+
+
+  // Runs build() with std::hash, FNV-1a, wyhash, and XXH64 over the same vocabulary.
+  std::vector<BucketStatistics> compareHashFunctions( const std::vector<std::string> & vocabulary, std::size_t reserve = 1000 );
+
+
+  // CSV writers, in the same layout final/ uses for its timing matrix:  a header row, then one row per key with comma separated
+  // values.
+  //   Summary:    Hash,Words,Buckets,Load Factor,...      one row per hash function
+  //   Histogram:  Bucket Size,std::hash,FNV-1a,...        one row per bucket size, one column per hash function
+  std::ostream & writeSummaryCsv  ( std::ostream & stream, const std::vector<BucketStatistics> & results );
+  std::ostream & writeHistogramCsv( std::ostream & stream, const std::vector<BucketStatistics> & results );
+}    // namespace HashDiagnostics
@@ -0,0 +1,156 @@
+#pragma once
+#include <cstddef>                                                      // size_t
+#include <cstdint>                                                      // uint8_t, uint32_t, uint64_t
+#include <cstring>                                                      // memcpy()
+#include <string>
+#include <string_view>
+
+
+// Alternative string hash functions that can be dropped into std::unordered_map in place of std::hash<std::string>.  Each is a
+// function object taking a string and returning a std::size_t, exactly like std::hash, so they can be compared against each
+// other on the same vocabulary (see HashDiagnostics.hpp).
+namespace HashFunctions
+{
+  namespace detail
+  {
+    inline std::uint64_t read64( const std::uint8_t * p ) { std::uint64_t v; std::memcpy( &v, p, sizeof v ); return v; }
+    inline std::uint64_t read32( const std::uint8_t * p ) { std::uint32_t v; std::memcpy( &v, p, sizeof v ); return v; }
+    inline std::uint64_t rotl  ( std::uint64_t x, int r ) { return ( x << r ) | ( x >> ( 64 - r ) ); }
+
+    // 64 x 64 -> 128 bit multiply, returning the low and high halves through lo and hi.  Done by hand with 32 bit partial
+    // products since unsigned __int128 isn't standard C++.
+    inline void multiply128( std::uint64_t & lo, std::uint64_t & hi )
+    {
+      std::uint64_t a = lo, b = hi;
+      std::uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+      std::uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+
+      std::uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+      std::uint64_t middle = ( ll >> 32 ) + ( lh & 0xFFFFFFFF ) + ( hl & 0xFFFFFFFF );
+
+      lo = ( middle << 32 ) | ( ll & 0xFFFFFFFF );
+      hi = hh + ( lh >> 32 ) + ( hl >> 32 ) + ( middle >> 32 );
+    }
+
+    inline std::uint64_t mix( std::uint64_t a, std::uint64_t b ) { multiply128( a, b ); return a ^ b; }
+  }    // namespace detail
+
+
+
+  // FNV-1a, 64 bit.  One xor and one multiply per byte:  simple, but every byte is a dependent step.
+  struct Fnv1a
+  {
+    std::size_t operator()( std::string_view key ) const noexcept
+    {
+      std::uint64_t hash = 14695981039346656037ULL;
+      for( unsigned char c : key ) hash = ( hash ^ c ) * 1099511628211ULL;
+      return hash;
+    }
+  };
+
+
+
+  // wyhash (final version 4 layout, default secret and seed 0).  Reads 4, 8, or 16 bytes at a time and folds them together with
+  // 128 bit multiplies.
+  struct WyHash
+  {
+    std::size_t operator()( std::string_view key ) const noexcept
+    {
+      using namespace detail;
+      constexpr std::uint64_t secret[] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+      const auto *  p    = reinterpret_cast<const std::uint8_t *>( key.data() );
+      std::size_t   len  = key.size();
+      std::uint64_t seed = mix( secret[0], secret[1] );
+      std::uint64_t a    = 0;
+      std::uint64_t b    = 0;
+
+      if( len <= 16 )
+      {
+        if( len >= 4 )
+        {
+          a = ( read32( p ) << 32 ) | read32( p + ( ( len >> 3 ) << 2 ) );
+          b = ( read32( p + len - 4 ) << 32 ) | read32( p + len - 4 - ( ( len >> 3 ) << 2 ) );
+        }
+        else if( len > 0 )
+        {
+          a = ( std::uint64_t{ p[0] } << 16 ) | ( std::uint64_t{ p[len >> 1] } << 8 ) | p[len - 1];
+        }
+      }
+      else
+      {
+        std::size_t i = len;
+        if( i > 48 )
+        {
+          std::uint64_t see1 = seed, see2 = seed;
+          do
+          {
+            seed = mix( read64( p      ) ^ secret[1], read64( p +  8 ) ^ seed );
+            see1 = mix( read64( p + 16 ) ^ secret[2], read64( p + 24 ) ^ see1 );
+            see2 = mix( read64( p + 32 ) ^ secret[3], read64( p + 40 ) ^ see2 );
+            p += 48;  i -= 48;
+          } while( i > 48 );
+          seed ^= see1 ^ see2;
+        }
+        while( i > 16 )
+        {
+          seed = mix( read64( p ) ^ secret[1], read64( p + 8 ) ^ seed );
+          p += 16;  i -= 16;
+        }
+        a = read64( p + i - 16 );
+        b = read64( p + i - 8  );
+      }
+
+      a ^= secret[1];
+      b ^= seed;
+      multiply128( a, b );
+      return mix( a ^ secret[0] ^ len, b ^ secret[1] );
+    }
+  };
+
+
+
+  // XXH64, seed 0.  XXH3 needs its 192 byte default secret and separate kernels for each input length class; XXH64 is the same
+  // family's portable 64 bit hash and behaves the same way on the short keys a vocabulary is made of.
+  struct Xxh64
+  {
+    std::size_t operator()( std::string_view key ) const noexcept
+    {
+      using namespace detail;
+      constexpr std::uint64_t P1 = 11400714785074694791ULL, P2 = 14029467366897019727ULL, P3 = 1609587929392839161ULL,
+                              P4 =  9650029242287828579ULL, P5 =  2870177450012600261ULL;
+
+      auto round = []( std::uint64_t acc, std::uint64_t input ) { return rotl( acc + input * P2, 31 ) * P1; };
+      auto merge = [&]( std::uint64_t acc, std::uint64_t value ) { return ( acc ^ round( 0, value ) ) * P1 + P4; };
+
+      const auto *  p   = reinterpret_cast<const std::uint8_t *>( key.data() );
+      const auto *  end = p + key.size();
+      std::uint64_t hash;
+
+      if( key.size() >= 32 )
+      {
+        std::uint64_t v1 = P1 + P2, v2 = P2, v3 = 0, v4 = 0 - P1;
+        for( ; p + 32 <= end; p += 32 )
+        {
+          v1 = round( v1, read64( p      ) );
+          v2 = round( v2, read64( p +  8 ) );
+          v3 = round( v3, read64( p + 16 ) );
+          v4 = round( v4, read64( p + 24 ) );
+        }
+        hash = rotl( v1, 1 ) + rotl( v2, 7 ) + rotl( v3, 12 ) + rotl( v4, 18 );
+        hash = merge( merge( merge( merge( hash, v1 ), v2 ), v3 ), v4 );
+      }
+      else hash = P5;
+
+      hash += key.size();
+      for( ; p + 8 <= end; p += 8 ) hash = rotl( hash ^ round( 0, read64( p ) ), 27 ) * P1 + P4;
+      if ( p + 4 <= end ) { hash = rotl( hash ^ ( read32( p ) * P1 ), 23 ) * P2 + P3;  p += 4; }
+      for( ; p < end; ++p ) hash = rotl( hash ^ ( *p * P5 ), 11 ) * P1;
+
+      hash ^= hash >> 33;  hash *= P2;
+      hash ^= hash >> 29;  hash *= P3;
+      hash ^= hash >> 32;
+      return hash;
+    }
+  };
+}    // namespace HashFunctions
@@ -0,0 +1,277 @@
+#include <algorithm>                                                    // sort(), unique(), lower_bound(), partial_sort(), min()
+#include <cmath>                                                        // log()
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined( __SSE2__ )
+  #include <emmintrin.h>                                                // _mm_cmpeq_epi32(), _mm_shuffle_epi32(), _mm_movemask_ps()
+#endif
+
+#include "InvertedIndex.hpp"
+#include "Sanitize.hpp"
+
+
+namespace
+{
+  // Postings are stored as LEB128 varints: 7 bits of payload per byte, with the high bit set on every byte but the last.  Book
+  // ids are delta-encoded first, so a word that appears in many books mostly costs a single byte per book.
+  void putVarint(std::vector<std::uint8_t> & bytes, std::uint32_t value)
+  {
+    while (value >= 0x80)
+    {
+      bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(value));
+  }
+
+  std::uint32_t getVarint(const std::uint8_t *& cursor)
+  {
+    std::uint32_t value = 0;
+    for (unsigned shift = 0;; shift += 7)
+    {
+      std::uint8_t byte = *cursor++;
+      value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  }
+
+  bool isIsbn(const std::string & stem)
+  {
+    if (stem.size() != 10 && stem.size() != 13) return false;
+    return std::all_of(stem.begin(), stem.end(), [](char c) { return (c >= '0' && c <= '9') || c == 'X' || c == 'x'; });
+  }
+
+  // Intersects two sorted, duplicate free lists of book ids.  With SSE2 this compares a block of 4 ids from each list against each
+  // other all at once (the block from b is rotated 3 times so every pair meets), then advances whichever block has the smaller
+  // maximum.  Whatever is left over is finished with a plain scalar merge.
+  std::vector<InvertedIndex::BookId> intersect(const std::vector<InvertedIndex::BookId> & a,
+                                               const std::vector<InvertedIndex::BookId> & b)
+  {
+    std::vector<InvertedIndex::BookId> result;
+    result.reserve(std::min(a.size(), b.size()));
+
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+#if defined( __SSE2__ )
+    while (i + 4 <= a.size() && j + 4 <= b.size())
+    {
+      __m128i blockA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a.data() + i));
+      __m128i blockB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b.data() + j));
+
+      __m128i matches = _mm_cmpeq_epi32(blockA, blockB);
+      blockB  = _mm_shuffle_epi32(blockB, _MM_SHUFFLE(0, 3, 2, 1));
+      matches = _mm_or_si128(matches, _mm_cmpeq_epi32(blockA, blockB));
+      blockB  = _mm_shuffle_epi32(blockB, _MM_SHUFFLE(0, 3, 2, 1));
+      matches = _mm_or_si128(matches, _mm_cmpeq_epi32(blockA, blockB));
+      blockB  = _mm_shuffle_epi32(blockB, _MM_SHUFFLE(0, 3, 2, 1));
+      matches = _mm_or_si128(matches, _mm_cmpeq_epi32(blockA, blockB));
+
+      int mask = _mm_movemask_ps(_mm_castsi128_ps(matches));
+      for (std::size_t k = 0; k < 4; ++k)
+        if (mask & (1 << k)) result.push_back(a[i + k]);
+
+      auto maxA = a[i + 3];
+      auto maxB = b[j + 3];
+      if (maxA <= maxB) i += 4;
+      if (maxB <= maxA) j += 4;
+    }
+#endif
+
+    while (i < a.size() && j < b.size())
+    {
+      if (a[i] < b[j])      ++i;
+      else if (b[j] < a[i]) ++j;
+      else                  { result.push_back(a[i]); ++i; ++j; }
+    }
+
+    return result;
+  }
+}    // namespace
+
+
+
+
+InvertedIndex::InvertedIndex(const std::filesystem::path & directory)
+{
+  std::error_code error;
+  for (const auto & entry : std::filesystem::directory_iterator(directory, error)) {
+    const auto & path = entry.path();
+    if (entry.is_regular_file() && path.extension() == ".bok" && isIsbn(path.stem().string())) {
+      _isbns.push_back(path.stem().string());
+    }
+  }
+
+  // Sorting the ISBNs makes the ids (and therefore the postings) identical no matter what order the directory is listed in, and
+  // lets wordCount() binary search for a book's id.
+  std::sort(_isbns.begin(), _isbns.end());
+
+  for (BookId book = 0; book < _isbns.size(); book++) {
+    std::ifstream file(directory / (_isbns[book] + ".bok"));
+
+    // Count this book's words locally first, so every word gets exactly one posting per book.
+    std::unordered_map<std::string, std::uint32_t> frequency;
+    frequency.reserve(1000);
+
+    std::string word;
+    while (file >> word) frequency[sanitize(word)]++;
+
+    for (const auto & [term, count] : frequency) append(_postings[term], { book, count });
+  }
+
+  for (auto & [term, list] : _postings) list.bytes.shrink_to_fit();
+}
+
+
+
+
+std::size_t InvertedIndex::numberOfBooks() const {
+  return _isbns.size();
+}
+
+std::size_t InvertedIndex::numberOfWords() const {
+  return _postings.size();
+}
+
+std::size_t InvertedIndex::sizeInBytes() const {
+  std::size_t bytes = 0;
+  for (const auto & [term, list] : _postings) bytes += list.bytes.size();
+  return bytes;
+}
+
+std::size_t InvertedIndex::wordCount(const std::string & isbn, const std::string & word) const {
+  auto it = std::lower_bound(_isbns.begin(), _isbns.end(), isbn);
+  if (it == _isbns.end() || *it != isbn) return 0;
+
+  auto book = static_cast<BookId>(it - _isbns.begin());
+  for (const auto & posting : decode(sanitize(word))) {
+    if (posting.book == book) return posting.frequency;
+    if (posting.book > book) break;
+  }
+
+  return 0;
+}
+
+
+
+
+std::vector<std::string> InvertedIndex::findAll(const std::vector<std::string> & words) const {
+  if (words.empty()) return {};
+
+  std::vector<std::vector<BookId>> lists;
+  for (const auto & word : words) {
+    lists.push_back(decodeIds(sanitize(word)));
+    if (lists.back().empty()) return {};                                  // one missing word means no book has them all
+  }
+
+  // Intersect the shortest lists first so the intermediate result shrinks as fast as possible.
+  std::sort(lists.begin(), lists.end(), [](const auto & lhs, const auto & rhs) { return lhs.size() < rhs.size(); });
+
+  auto result = std::move(lists.front());
+  for (std::size_t i = 1; i < lists.size() && !result.empty(); i++) result = intersect(result, lists[i]);
+
+  return isbnsOf(result);
+}
+
+std::vector<std::string> InvertedIndex::findAny(const std::vector<std::string> & words) const {
+  std::vector<BookId> result;
+  for (const auto & word : words) {
+    auto ids = decodeIds(sanitize(word));
+    result.insert(result.end(), ids.begin(), ids.end());
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+
+  return isbnsOf(result);
+}
+
+std::vector<InvertedIndex::Match> InvertedIndex::topK(const std::vector<std::string> & words, std::size_t k) const {
+  std::vector<std::string> terms;
+  for (const auto & word : words) terms.push_back(sanitize(word));
+
+  // A word repeated in the query shouldn't count twice.
+  std::sort(terms.begin(), terms.end());
+  terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+
+  std::vector<double> scores(_isbns.size(), 0.0);
+  std::vector<bool>   touched(_isbns.size(), false);
+  const auto          books = static_cast<double>(_isbns.size());
+
+  for (const auto & term : terms) {
+    auto it = _postings.find(term);
+    if (it == _postings.end()) continue;
+
+    // Smoothed inverse document frequency, so a word found in every book still scores a little.  Term frequency is dampened
+    // logarithmically so a word said 4000 times doesn't drown out everything else.
+    double idf = std::log(1.0 + books / it->second.documentFrequency);
+    for (const auto & posting : decode(term)) {
+      scores[posting.book] += (1.0 + std::log(static_cast<double>(posting.frequency))) * idf;
+      touched[posting.book] = true;
+    }
+  }
+
+  std::vector<Match> matches;
+  for (BookId book = 0; book < _isbns.size(); book++) {
+    if (touched[book]) matches.push_back({ _isbns[book], scores[book] });
+  }
+
+  auto better = [](const Match & lhs, const Match & rhs) {
+    if (lhs.score > rhs.score) return true;
+    if (lhs.score < rhs.score) return false;
+    return lhs.isbn < rhs.isbn;
+  };
+
+  k = std::min(k, matches.size());
+  std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(k), matches.end(), better);
+  matches.resize(k);
+
+  return matches;
+}
+
+
+
+
+void InvertedIndex::append(PostingsList & list, Posting posting) {
+  // The very first posting is stored as a delta from 0, i.e. the book id itself.
+  putVarint(list.bytes, posting.book - list.lastBook);
+  putVarint(list.bytes, posting.frequency);
+
+  list.lastBook = posting.book;
+  list.documentFrequency++;
+}
+
+std::vector<InvertedIndex::Posting> InvertedIndex::decode(const std::string & word) const {
+  auto it = _postings.find(word);
+  if (it == _postings.end()) return {};
+
+  const auto & list = it->second;
+
+  std::vector<Posting> postings;
+  postings.reserve(list.documentFrequency);
+
+  BookId book   = 0;
+  auto * cursor = list.bytes.data();
+  for (std::uint32_t i = 0; i < list.documentFrequency; i++) {
+    book += getVarint(cursor);
+    postings.push_back({ book, getVarint(cursor) });
+  }
+
+  return postings;
+}
+
+std::vector<InvertedIndex::BookId> InvertedIndex::decodeIds(const std::string & word) const {
+  std::vector<BookId> ids;
+  for (const auto & posting : decode(word)) ids.push_back(posting.book);
+  return ids;
+}
+
+std::vector<std::string> InvertedIndex::isbnsOf(const std::vector<BookId> & books) const {
+  std::vector<std::string> isbns;
+  isbns.reserve(books.size());
+  for (auto book : books) isbns.push_back(_isbns[book]);
+  return isbns;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>                                                      // size_t
+#include <cstdint>                                                      // uint8_t, uint32_t
+#include <filesystem>                                                   // path
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// A cross-book inverted index over every ISBN.bok file in a directory.  Words are tokenized with the same sanitize() rules
+// ExtendedBook uses, so a word's term frequency here always matches ExtendedBook::wordCount() for the same book.
+//
+// Each word maps to a postings list of (book, term frequency) pairs sorted by book.  Books are identified by a dense 32 bit id
+// (their position in the sorted list of ISBNs), and postings are stored delta-encoded and varint-compressed.
+class InvertedIndex
+{
+  public:
+    // Types
+    using BookId = std::uint32_t;
+
+    struct Match                                                        // A single ranked search result
+    {
+      std::string isbn;
+      double      score = 0.0;
+    };
+
+    // Constructors
+    InvertedIndex( const std::filesystem::path & directory = "." );    // Indexes every ISBN.bok file found in directory
+
+    // Queries
+    std::size_t numberOfBooks() const;                                  // Returns the number of books indexed
+    std::size_t numberOfWords() const;                                  // Returns the number of unique words across all books
+    std::size_t sizeInBytes  () const;                                  // Returns the number of bytes used by the compressed postings
+    std::size_t wordCount    ( const std::string & isbn,                // Returns the number of occurrences of word in the book
+                               const std::string & word  ) const;       // identified by isbn, 0 if either doesn't exist
+
+    std::vector<std::string> findAll( const std::vector<std::string> & words ) const;   // Returns ISBNs of books containing every word (AND)
+    std::vector<std::string> findAny( const std::vector<std::string> & words ) const;   // Returns ISBNs of books containing any word (OR)
+    std::vector<Match>       topK   ( const std::vector<std::string> & words,           // Returns at most k books ranked by TF-IDF
+                                      std::size_t                      k     ) const;   // score, best match first
+
+  private:
+    struct Posting
+    {
+      BookId        book;
+      std::uint32_t frequency;
+    };
+
+    struct PostingsList
+    {
+      std::vector<std::uint8_t> bytes;                                  // varint(book delta), varint(frequency) pairs
+      std::uint32_t             documentFrequency = 0;                  // number of books containing the word
+      BookId                    lastBook          = 0;                  // last book appended, the base of the next delta
+    };
+
+    std::vector<std::string>                      _isbns;               // BookId -> ISBN, sorted so ids are stable between runs
+    std::unordered_map<std::string, PostingsList> _postings;            // sanitized word -> postings list
+
+    // Helper functions
+    void                 append   ( PostingsList & list, Posting posting );
+    std::vector<Posting> decode   ( const std::string & word             ) const;   // word must already be sanitized
+    std::vector<BookId>  decodeIds( const std::string & word             ) const;
+    std::vector<std::string> isbnsOf( const std::vector<BookId> & books  ) const;
+};
@@ -0,0 +1,101 @@
+#include <algorithm>   // count()
+#include <cstddef>     // size_t
+#include <exception>
+#include <iostream>    // clog
+#include <sstream>
+#include <string>
+
+#include "CheckResults.hpp"
+#include "ExtendedBook.hpp"
+#include "HashDiagnostics.hpp"
+#include "HashFunctions.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class HashDiagnosticsRegressionTest
+  {
+    public:
+      HashDiagnosticsRegressionTest();
+
+    private:
+      void hashFunctions();
+      void diagnostics  ();
+
+      Regression::CheckResults affirm;
+  } run_hashDiagnostics_tests;
+
+
+
+
+  void HashDiagnosticsRegressionTest::hashFunctions()
+  {
+    // Published reference values
+    affirm.is_true( "FNV-1a  - \"a\"  ", HashFunctions::Fnv1a {}( "a"   ) == 0xaf63dc4c8601ec8cULL );
+    affirm.is_true( "XXH64   - \"\"   ", HashFunctions::Xxh64 {}( ""    ) == 0xef46db3751d8e999ULL );
+    affirm.is_true( "XXH64   - \"abc\"", HashFunctions::Xxh64 {}( "abc" ) == 0x44bc2cf5ad770999ULL );
+    affirm.is_true( "wyhash  - \"\"   ", HashFunctions::WyHash{}( ""    ) == 0x93228a4de0eec5a2ULL );
+  }
+
+
+
+  void HashDiagnosticsRegressionTest::diagnostics()
+  {
+    ExtendedBook franky( "Frankenstein", "Shelly", "9789998819450" );
+    auto         stats = franky.bucketStatistics();
+
+    affirm.is_equal( "Bucket statistics - words           ", franky.numberOfWords(), stats.words         );
+    affirm.is_equal( "Bucket statistics - max bucket size ", franky.maxBucketSize(), stats.maxBucketSize );
+    affirm.is_true ( "Bucket statistics - rehashed        ", stats.rehashes > 0                          );
+
+    std::size_t buckets = 0;
+    std::size_t words   = 0;
+    for( const auto & [size, count] : stats.histogram ) { buckets += count;  words += size * count; }
+
+    affirm.is_equal( "Histogram - covers every bucket     ", stats.buckets, buckets );
+    affirm.is_equal( "Histogram - covers every word       ", stats.words,   words   );
+    affirm.is_true ( "Probe length - at least one compare ", stats.observedProbeLength >= 1.0 && stats.expectedProbeLength >= 1.0 );
+
+
+    auto results = HashDiagnostics::compareHashFunctions( franky.vocabulary() );
+    affirm.is_equal( "Compare - one result per hash       ", 4U, results.size() );
+
+    bool sameTableSize = true;
+    for( const auto & result : results ) sameTableSize = sameTableSize && result.words == stats.words && result.buckets == stats.buckets;
+    affirm.is_true ( "Compare - same vocabulary and size  ", sameTableSize );
+
+
+    std::ostringstream summary;
+    HashDiagnostics::writeSummaryCsv( summary, results );
+    auto               csv = summary.str();
+    affirm.is_equal( "Summary CSV - header and one row each", 5, std::count( csv.begin(), csv.end(), '\n' ) );
+
+    std::ostringstream histogram;
+    HashDiagnostics::writeHistogramCsv( histogram, results );
+    affirm.is_true ( "Histogram CSV - header              ", histogram.str().starts_with( "Bucket Size,std::hash,FNV-1a,wyhash,XXH64\n" ) );
+  }
+
+
+
+  HashDiagnosticsRegressionTest::HashDiagnosticsRegressionTest()
+  {
+    try
+    {
+      std::clog << "\nHash Diagnostics Regression Test:  Hash functions\n";
+      hashFunctions();
+
+      std::clog << "\nHash Diagnostics Regression Test:  Bucket statistics\n";
+      diagnostics();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"HashDiagnostics\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,154 @@
+#include <algorithm>   // set_intersection()
+#include <cstddef>     // size_t
+#include <exception>
+#include <filesystem>  // temp_directory_path(), create_directories(), remove_all()
+#include <fstream>
+#include <iostream>    // clog
+#include <iterator>    // back_inserter()
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "CheckResults.hpp"
+#include "InvertedIndex.hpp"
+
+
+
+
+
+namespace  // anonymous
+{
+  class InvertedIndexRegressionTest
+  {
+    public:
+      InvertedIndexRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_invertedIndex_tests;
+
+
+
+
+  void InvertedIndexRegressionTest::tests()
+  {
+    const std::string frankenstein = "9789998819450";
+    const std::string sleepyHollow = "9789998302938";
+
+    InvertedIndex index( "." );
+
+    affirm.is_equal( "Index construction - books indexed           ", 2U, index.numberOfBooks() );
+    affirm.is_true ( "Index construction - postings are compressed ",    index.sizeInBytes() > 0 );
+
+    // Term frequencies must agree with ExtendedBook::wordCount()
+    affirm.is_equal( "wordCount - Frankenstein in Frankenstein     ",   24U, index.wordCount( frankenstein, "Frankenstein"       ) );
+    affirm.is_equal( "wordCount - the in Frankenstein              ", 4187U, index.wordCount( frankenstein, "the"                ) );
+    affirm.is_equal( "wordCount - Ichabod in Sleepy Hollow         ",   45U, index.wordCount( sleepyHollow, "Ichabod"            ) );
+    affirm.is_equal( "wordCount - nonexistent word                 ",    0U, index.wordCount( sleepyHollow, "non-existent-!word" ) );
+    affirm.is_equal( "wordCount - nonexistent book                 ",    0U, index.wordCount( "0000000000", "the"                ) );
+
+    {
+      auto found = index.findAll( { "the" } );
+      affirm.is_equal( "findAll - word in every book, size           ", 2U, found.size() );
+      affirm.is_true ( "findAll - word in every book, sorted by ISBN ",    found.size() == 2 && found[0] == sleepyHollow && found[1] == frankenstein );
+    }
+
+    {
+      auto found = index.findAll( { "Ichabod", "the" } );
+      affirm.is_true ( "findAll - AND of two words                   ",    found == std::vector<std::string>{ sleepyHollow } );
+
+      found = index.findAll( { "Ichabod", "Frankenstein" } );
+      affirm.is_true ( "findAll - AND with no common book            ",    found.empty() );
+
+      found = index.findAll( { "Ichabod", "non-existent-!word" } );
+      affirm.is_true ( "findAll - AND with a missing word            ",    found.empty() );
+    }
+
+    {
+      auto found = index.findAny( { "Ichabod", "Frankenstein" } );
+      affirm.is_true ( "findAny - OR of two words                    ",    found == std::vector<std::string>{ sleepyHollow, frankenstein } );
+
+      found = index.findAny( { "non-existent-!word" } );
+      affirm.is_true ( "findAny - OR with a missing word             ",    found.empty() );
+    }
+
+    {
+      auto ranked = index.topK( { "Ichabod", "the" }, 5 );
+      affirm.is_equal( "topK - only matching books returned          ", 2U, ranked.size() );
+      affirm.is_true ( "topK - rarer word ranks its book first       ",    !ranked.empty() && ranked[0].isbn == sleepyHollow );
+
+      ranked = index.topK( { "the" }, 1 );
+      affirm.is_equal( "topK - truncated to k                        ", 1U, ranked.size() );
+    }
+
+    {
+      // The two book corpus never gives a word more than 4 books, so the block at a time intersection is tried on a synthetic one.
+      // Each word's books follow a different pattern, so lists are long, of different lengths, none a multiple of 4, and match in
+      // every position of a block.
+      const std::size_t                 bookCount = 103;
+      const std::vector<std::string>    words     = { "every", "second", "third", "seventh", "sparse", "late" };
+      auto has = []( std::size_t word, std::size_t book )
+      {
+        switch( word )
+        {
+          case 0:  return true;
+          case 1:  return book % 2 == 0;
+          case 2:  return book % 3 == 0;
+          case 3:  return book % 7 == 3;
+          case 4:  return book * book % 11 < 4;
+          default: return book > 60  &&  book % 5 != 2;
+        }
+      };
+
+      std::error_code ignored;
+      auto corpus = std::filesystem::temp_directory_path() / "InvertedIndexTests-corpus";
+      std::filesystem::remove_all( corpus, ignored );
+      std::filesystem::create_directories( corpus );
+
+      std::vector<std::vector<std::string>> booksWith( words.size() );
+      for( std::size_t book = 0; book < bookCount; ++book )
+      {
+        auto isbn = std::to_string( 1'000'000'000 + book );
+        std::ofstream file( corpus / ( isbn + ".bok" ) );
+        for( std::size_t word = 0; word < words.size(); ++word ) if( has( word, book ) )
+        {
+          file << words[word] << ' ';
+          booksWith[word].push_back( isbn );
+        }
+      }
+
+      InvertedIndex synthetic( corpus );
+      bool allAgree = synthetic.numberOfBooks() == bookCount;
+      for( std::size_t first = 0; first < words.size(); ++first ) for( std::size_t second = 0; second < words.size(); ++second )
+      {
+        std::vector<std::string> expected;
+        std::set_intersection( booksWith[first].begin(),  booksWith[first].end(),
+                               booksWith[second].begin(), booksWith[second].end(), std::back_inserter( expected ) );
+        allAgree = allAgree  &&  synthetic.findAll( { words[first], words[second] } ) == expected;
+      }
+      affirm.is_true( "findAll - long lists agree with set_intersection", allAgree );
+
+      std::filesystem::remove_all( corpus, ignored );
+    }
+  }
+
+
+
+  InvertedIndexRegressionTest::InvertedIndexRegressionTest()
+  {
+    try
+    {
+      std::clog << "\nInverted Index Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class InvertedIndex\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,25 @@
+#pragma once
+#include <locale>                                                           // tolower()
+#include <string>
+
+
+// Non-member helper function shared by everything that tokenizes a book's text.  Strips the leading and trailing punctuation
+// from a word and lower cases what's left, so ExtendedBook and InvertedIndex agree on what a "word" is.
+inline std::string sanitize( const std::string & word )
+{
+  constexpr char bad_char[] = " \t\n\b\v_-\"'(){}+/*,=.!?:;";            // leading and trailing characters to be removed
+  static std::locale locality;
+
+  auto startIndex = word.find_first_not_of( bad_char );                  // start with the first non-bad character
+  if( startIndex == std::string::npos ) startIndex = word.size();        // if the word contains only bad characters ...
+
+  std::size_t count    = 0;                                              // assume the word contains only bad characters ...
+  auto        endIndex = word.find_last_not_of( bad_char );              // end with the first non-bad character
+
+  if( endIndex != std::string::npos ) count = endIndex - startIndex + 1; // number of characters to use in results
+
+  auto result = word.substr( startIndex, count );                        // strip the leading and trailing bad characters
+  for( auto & c : result ) c = std::tolower( c, locality );              // convert to lower case
+
+  return result;
+}
@@ -0,0 +1,353 @@
+#include <cctype>       // isalnum(), isspace()
+#include <cstddef>      // size_t
+#include <cstdint>      // int64_t
+#include <ctime>        // time(), gmtime(), strftime()
+#include <fstream>
+#include <functional>   // function
+#include <iomanip>      // setw(), setprecision()
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>       // to_string(), stoll(), stoull()
+#include <thread>       // hardware_concurrency()
+#include <utility>      // pair
+#include <vector>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+  #include <sys/utsname.h>    // uname()
+  #include <unistd.h>         // gethostname()
+#endif
+
+#include "BenchmarkReport.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  std::string jsonEscaped( std::string const & text )
+  {
+    std::string result;
+    for( char c : text )
+    {
+      if     ( c == '"'  ||  c == '\\' )                  { result += '\\';  result += c; }
+      else if( c == '\n' )                                  result += "\\n";
+      else if( static_cast<unsigned char>( c ) >= 0x20 )   result += c;
+    }
+    return result;
+  }
+
+
+
+
+  // Just enough of a JSON reader for the files writeJson() writes:  objects, arrays, strings, and numbers.  Scalars are handed
+  // back as text and converted by the caller.
+  class JsonReader
+  {
+    public:
+      explicit JsonReader( std::istream & stream ) : _stream( stream ) {}
+
+      void object( std::function<void( std::string const & key )> const & member )
+      {
+        expect( '{' );
+        if( peek() == '}' ) { _stream.get();  return; }
+
+        do
+        {
+          auto key = string();
+          expect( ':' );
+          member( key );
+        } while( optional( ',' ) );
+        expect( '}' );
+      }
+
+      void array( std::function<void()> const & element )
+      {
+        expect( '[' );
+        if( peek() == ']' ) { _stream.get();  return; }
+
+        do element(); while( optional( ',' ) );
+        expect( ']' );
+      }
+
+      std::string scalar()
+      {
+        if( peek() == '"' )   return string();
+
+        std::string token;
+        while( _stream  &&  ( std::isalnum( _stream.peek() )  ||  _stream.peek() == '-'  ||  _stream.peek() == '+'  ||  _stream.peek() == '.' ) )
+        {
+          token += static_cast<char>( _stream.get() );
+        }
+        if( token.empty() )   fail( "a value" );
+        return token;
+      }
+
+      void skip()                                                                             // any value, e.g. a member added by a later version
+      {
+        switch( peek() )
+        {
+          case '{':  object( [this]( std::string const & ) { skip(); } );  break;
+          case '[':  array ( [this]                        { skip(); } );  break;
+          default:   scalar();                                              break;
+        }
+      }
+
+
+    private:
+      int peek()
+      {
+        while( std::isspace( _stream.peek() ) ) _stream.get();
+        return _stream.peek();
+      }
+
+      void expect  ( char c ) { if( peek() != c )   fail( std::string( "'" ) + c + "'" );  _stream.get(); }
+      bool optional( char c ) { if( peek() != c )   return false;                            _stream.get();  return true; }
+
+      std::string string()
+      {
+        expect( '"' );
+        std::string result;
+        for( int c = _stream.get(); c != '"'; c = _stream.get() )
+        {
+          if( c == std::char_traits<char>::eof() )   fail( "a closing quote" );
+          if( c == '\\' )
+          {
+            c = _stream.get();
+            if( c == 'n' )   c = '\n';
+          }
+          result += static_cast<char>( c );
+        }
+        return result;
+      }
+
+      [[noreturn]] void fail( std::string const & expected )
+      {
+        throw Benchmark::ReportFormat_Ex( "Malformed benchmark results:  expected " + expected + " at offset " + std::to_string( _stream.tellg() ) );
+      }
+
+      std::istream & _stream;
+  };
+
+
+
+
+  // Pools a report's histograms over every size, per structure/operation
+  std::map<std::string, Utilities::LatencyHistogram> pooled( Benchmark::Report const & report )
+  {
+    std::map<std::string, Utilities::LatencyHistogram> result;
+    for( auto const & cell : report.cells )   result[cell.structure + '/' + cell.operation] += cell.latencies;
+    return result;
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Benchmark
+{
+  Metadata describeHost()
+  {
+    Metadata metadata;
+
+    char        timestamp[32] = "unknown";
+    std::time_t now           = std::time( nullptr );
+    std::strftime( timestamp, sizeof( timestamp ), "%Y-%m-%dT%H:%M:%SZ", std::gmtime( &now ) );
+    metadata.emplace_back( "timestamp", timestamp );
+
+    #if defined( __unix__ ) || defined( __APPLE__ )
+      char host[256] = "unknown";
+      gethostname( host, sizeof( host ) - 1 );
+      metadata.emplace_back( "host", host );
+
+      if( utsname system; uname( &system ) == 0 )   metadata.emplace_back( "os", std::string( system.sysname ) + ' ' + system.release + ' ' + system.machine );
+    #endif
+
+    std::ifstream cpuinfo( "/proc/cpuinfo" );                                                 // Linux only, silently skipped elsewhere
+    for( std::string line; std::getline( cpuinfo, line ); )
+    {
+      if( line.starts_with( "model name" )  &&  line.find( ':' ) != std::string::npos )
+      {
+        metadata.emplace_back( "processor", line.substr( line.find( ':' ) + 2 ) );
+        break;
+      }
+    }
+    metadata.emplace_back( "cores", std::to_string( std::thread::hardware_concurrency() ) );
+
+    #if defined( __clang__ )
+      metadata.emplace_back( "compiler", "clang++ " __clang_version__ );
+    #elif defined( __GNUC__ )
+      metadata.emplace_back( "compiler", "g++ " __VERSION__ );
+    #elif defined( _MSC_VER )
+      metadata.emplace_back( "compiler", "MSVC " + std::to_string( _MSC_FULL_VER ) );
+    #else
+      metadata.emplace_back( "compiler", "unknown" );
+    #endif
+    metadata.emplace_back( "c++ standard", std::to_string( __cplusplus ) );
+
+    #ifdef NDEBUG
+      std::string build = "NDEBUG";
+    #else
+      std::string build = "debug";
+    #endif
+    #ifdef __OPTIMIZE__
+      build += ", optimized";
+    #endif
+    metadata.emplace_back( "build", build );
+
+    #ifdef BENCHMARK_BUILD_FLAGS
+      metadata.emplace_back( "build flags", BENCHMARK_BUILD_FLAGS );
+    #endif
+
+    return metadata;
+  }
+
+
+
+
+  void writeCsvMetadata( std::ostream & stream, Metadata const & metadata )
+  {
+    for( auto const & [key, value] : metadata )   stream << "# " << key << ": " << value << '\n';
+  }
+
+
+
+
+  void writeJson( std::ostream & stream, Report const & report )
+  {
+    stream << "{\n  \"metadata\": {";
+    for( std::size_t i = 0; i < report.metadata.size(); ++i )
+    {
+      stream << ( i == 0 ? "\n" : ",\n" )
+             << "    \"" << jsonEscaped( report.metadata[i].first ) << "\": \"" << jsonEscaped( report.metadata[i].second ) << '"';
+    }
+
+    stream << "\n  },\n  \"results\": [";
+    for( std::size_t i = 0; i < report.cells.size(); ++i )
+    {
+      auto const & cell = report.cells[i];
+      stream << ( i == 0 ? "\n" : ",\n" )
+             << "    {\"size\": "       << cell.size
+             << ", \"structure\": \""   << jsonEscaped( cell.structure ) << '"'
+             << ", \"operation\": \""   << jsonEscaped( cell.operation ) << '"'
+             << ", \"total_ns\": "      << cell.totalNS
+             << ", \"count\": "         << cell.latencies.count()
+             << ", \"p50_ns\": "        << cell.latencies.percentile( 50.0 )
+             << ", \"p90_ns\": "        << cell.latencies.percentile( 90.0 )
+             << ", \"p99_ns\": "        << cell.latencies.percentile( 99.0 )
+             << ", \"p99.9_ns\": "      << cell.latencies.percentile( 99.9 )
+             << ", \"max_ns\": "        << cell.latencies.max()
+             << ", \"histogram\": \""   << cell.latencies << "\"}";
+    }
+    stream << "\n  ]\n}\n";
+  }
+
+
+
+
+  Report readJson( std::istream & stream )
+  {
+    Report     report;
+    JsonReader json( stream );
+
+    json.object( [&]( std::string const & section )
+    {
+      if( section == "metadata" )
+      {
+        json.object( [&]( std::string const & key ) { report.metadata.emplace_back( key, json.scalar() ); } );
+      }
+
+      else if( section == "results" )
+      {
+        json.array( [&]
+        {
+          Cell cell;
+          json.object( [&]( std::string const & key )
+          {
+            if     ( key == "size"      )   cell.size      = std::stoull( json.scalar() );
+            else if( key == "structure" )   cell.structure = json.scalar();
+            else if( key == "operation" )   cell.operation = json.scalar();
+            else if( key == "total_ns"  )   cell.totalNS   = std::stoll( json.scalar() );
+            else if( key == "histogram" )
+            {
+              std::istringstream histogram( json.scalar() );
+              if( !( histogram >> cell.latencies ) )   throw ReportFormat_Ex( "Malformed benchmark results:  unreadable histogram" );
+            }
+            else json.skip();                                                                 // the percentiles are derived from the histogram
+          } );
+          report.cells.push_back( std::move( cell ) );
+        } );
+      }
+
+      else json.skip();
+    } );
+
+    return report;
+  }
+
+
+
+
+  std::size_t compare( Report const & baseline, Report const & candidate, std::ostream & stream, double thresholdPercent, double alpha )
+  {
+    // Comparisons only mean something between like runs, so point out whatever differs (other than when they ran)
+    std::map<std::string, std::string> baselineMetadata( baseline.metadata.begin(), baseline.metadata.end() );
+    for( auto const & [key, value] : candidate.metadata )
+    {
+      if( key == "timestamp" )   continue;
+      if( auto other = baselineMetadata.find( key );  other != baselineMetadata.end()  &&  other->second != value )
+      {
+        stream << "Note:  " << key << " differs (" << other->second << " vs " << value << ")\n";
+      }
+    }
+
+
+    auto lhs = pooled( baseline  );
+    auto rhs = pooled( candidate );
+
+    stream << '\n'
+           << std::left  << std::setw( 40 ) << "Structure/Operation"
+           << std::right << std::setw( 14 ) << "Baseline p50" << std::setw( 14 ) << "Candidate p50" << std::setw( 10 ) << "Change"
+                         << std::setw( 14 ) << "Baseline p99" << std::setw( 14 ) << "Candidate p99" << std::setw( 11 ) << "p-value"
+                         << "  Verdict\n";
+
+    std::size_t regressions = 0;
+    std::size_t missing     = 0;
+    for( auto const & [name, before] : lhs )
+    {
+      auto after = rhs.find( name );
+      if( after == rhs.end() )
+      {
+        stream << std::left << std::setw( 40 ) << name << "  MISSING, not measured by the candidate\n";
+        ++missing;
+        continue;
+      }
+
+      auto   result = compare( before, after->second );
+      auto   p50    = static_cast<double>( before.percentile( 50.0 ) );
+      double change = p50 > 0.0 ? ( static_cast<double>( after->second.percentile( 50.0 ) ) - p50 ) / p50 * 100.0 : 0.0;
+
+      std::string verdict = "no significant change";
+      if( result.pValue < alpha  &&  change >  thresholdPercent ) { verdict = "REGRESSION";  ++regressions; }
+      if( result.pValue < alpha  &&  change < -thresholdPercent )   verdict = "improvement";
+
+      stream << std::left  << std::setw( 40 ) << name
+             << std::right << std::setw( 14 ) << before.percentile( 50.0 ) << std::setw( 14 ) << after->second.percentile( 50.0 )
+                           << std::setw( 9 )  << std::fixed << std::setprecision( 1 ) << change << '%'
+                           << std::setw( 14 ) << before.percentile( 99.0 ) << std::setw( 14 ) << after->second.percentile( 99.0 )
+                           << std::setw( 11 ) << std::scientific << std::setprecision( 1 ) << result.pValue << std::defaultfloat
+                           << "  " << verdict << '\n';
+    }
+
+    for( auto const & [name, after] : rhs )   if( !lhs.contains( name ) ) stream << std::left << std::setw( 40 ) << name << "  not measured by the baseline\n";
+
+    stream << '\n' << regressions << " significant regression(s), p < " << alpha << " and a median more than " << thresholdPercent << "% slower\n";
+    if( missing > 0 )   stream << missing << " structure/operation(s) missing from the candidate\n";
+    return regressions + missing;
+  }
+}  // namespace Benchmark
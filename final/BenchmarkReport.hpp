@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>      // size_t
+#include <cstdint>      // int64_t
+#include <iostream>
+#include <stdexcept>    // runtime_error
+#include <string>
+#include <utility>      // pair
+#include <vector>
+
+#include "LatencyHistogram.hpp"
+
+
+
+
+
+namespace Benchmark
+{
+  // Everything needed to reproduce, or at least explain, a run:  machine, compiler, build, dataset, seed, ...  Kept in the order added.
+  using Metadata = std::vector<std::pair<std::string, std::string>>;
+
+  // All the samples of one operation on one structure within one size interval
+  struct Cell
+  {
+    std::size_t                 size = 0;
+    std::string                 structure;
+    std::string                 operation;
+    std::int64_t                totalNS = 0;
+    Utilities::LatencyHistogram latencies;
+  };
+
+  struct Report
+  {
+    Metadata          metadata;
+    std::vector<Cell> cells;
+  };
+
+  struct ReportFormat_Ex : std::runtime_error { using runtime_error::runtime_error; };      // Thrown if a result file can't be read
+
+
+
+  // Describes this machine, compiler, and build.  Define BENCHMARK_BUILD_FLAGS when compiling to record the exact flags too.
+  Metadata describeHost();
+
+
+  // Emitters.  The CSV is the usual Size-by-operation table preceded by the metadata as "# key: value" comment lines.  The JSON
+  // carries every cell's histogram as well, so two runs can be compared sample by sample.
+  void   writeCsvMetadata( std::ostream & stream, Metadata const & metadata );
+  void   writeJson       ( std::ostream & stream, Report   const & report   );
+  Report readJson        ( std::istream & stream );                                         // reads what writeJson() wrote
+
+
+  // Compares each structure/operation's latencies, pooled over all sizes, between two runs with a Mann-Whitney U test.  A change is
+  // significant when its p-value is below alpha and the median moved by more than thresholdPercent.  Writes a table of changes to
+  // stream, and returns the number of significant regressions plus the number of structure/operations the candidate is missing
+  // (a case that crashed measured nothing, which is no better).
+  std::size_t compare( Report const & baseline, Report const & candidate, std::ostream & stream,
+                       double thresholdPercent = 5.0, double alpha = 0.01 );
+}  // namespace Benchmark
@@ -0,0 +1,190 @@
+#include <algorithm>    // max(), reverse()
+#include <cerrno>       // errno, EINTR
+#include <chrono>       // steady_clock, duration_cast<>(), milliseconds
+#include <cstddef>      // size_t
+#include <cstdlib>      // _Exit()
+#include <exception>
+#include <filesystem>   // temp_directory_path(), remove()
+#include <fstream>
+#include <functional>   // function
+#include <iostream>
+#include <string>       // to_string()
+#include <system_error> // error_code
+#include <thread>       // sleep_for()
+#include <vector>
+
+#ifdef __linux__
+  #include <sched.h>      // sched_getaffinity(), sched_setaffinity(), cpu_set_t
+  #include <sys/wait.h>   // waitpid(), WIFEXITED(), WEXITSTATUS()
+  #include <unistd.h>     // fork(), getpid()
+#endif
+
+#include "BenchmarkRunner.hpp"
+#include "Timer.hpp"
+#include "TraceTimer.hpp"
+
+
+
+
+
+namespace Benchmark
+{
+  void runInProcess( std::vector<Case> const & cases )
+  {
+    for( std::size_t first = 0, last = 0; first < cases.size(); first = last )
+    {
+      while( last < cases.size()  &&  cases[last].group == cases[first].group ) ++last;
+
+      std::clog << "\nStarting to collect " << cases[first].group << " measurements\n";
+      Utilities::Timer timer{ "Timer:  " + cases[first].group + " measurements completed in ", std::clog };
+
+      for( std::size_t i = first; i < last; ++i )
+      {
+        Utilities::TraceTimer traced{ Utilities::TraceSession::label( cases[i].group + "'s " + cases[i].name ) };
+        cases[i].run();
+      }
+    }
+  }
+
+
+
+
+  std::size_t runIsolated( std::vector<Case> const &                     cases,
+                           std::size_t                                   workers,
+                           std::function<void()>                 const & reset,
+                           std::function<void( std::ostream & )> const & save,
+                           std::function<void( std::istream & )> const & merge )
+  {
+    #ifndef __linux__
+      ( void ) workers;  ( void ) reset;  ( void ) save;  ( void ) merge;
+      runInProcess( cases );
+      return 0;
+
+    #else
+      // The cores this process is allowed to run on, one per worker
+      std::vector<int> freeCores;
+      cpu_set_t        allowed;
+      CPU_ZERO( &allowed );
+      if( sched_getaffinity( 0, sizeof( allowed ), &allowed ) == 0 )
+      {
+        for( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )   if( CPU_ISSET( cpu, &allowed ) ) freeCores.push_back( cpu );
+      }
+      if( freeCores.empty() )   freeCores.push_back( 0 );
+
+      workers = std::max<std::size_t>( workers, 1 );
+      if( freeCores.size() > workers )   freeCores.resize( workers );
+      std::reverse( freeCores.begin(), freeCores.end() );                       // hand out the lowest numbered cores first
+
+      std::clog << "\nRunning " << cases.size() << " cases in isolated workers on " << freeCores.size() << " cores\n";
+
+
+      struct Worker
+      {
+        pid_t                                 pid;
+        std::size_t                           caseIndex;
+        int                                   core;
+        std::filesystem::path                 results;
+        std::chrono::steady_clock::time_point started;
+      };
+
+      std::vector<Worker> running;
+      std::size_t         nextCase = 0;
+      std::size_t         failures = 0;
+
+      while( nextCase < cases.size()  ||  !running.empty() )
+      {
+        // Start as many cases as there are idle cores
+        while( nextCase < cases.size()  &&  !freeCores.empty() )
+        {
+          int  core    = freeCores.back();
+          auto results = std::filesystem::temp_directory_path() / ( "benchmark-" + std::to_string( getpid() ) + '-' + std::to_string( nextCase ) + ".txt" );
+
+          std::cout.flush();                                                    // or the child flushes a second copy of anything still buffered
+          std::clog.flush();
+
+          pid_t pid = fork();
+          if( pid == 0 )                                                        // the child
+          {
+            int status = EXIT_FAILURE;
+            try
+            {
+              cpu_set_t mine;
+              CPU_ZERO( &mine );
+              CPU_SET( core, &mine );
+              sched_setaffinity( 0, sizeof( mine ), &mine );
+
+              std::clog.setstate( std::ios::badbit );                           // the parent reports progress, not the children
+              reset();                                                          // save only this case's results, not those merged so far
+              cases[nextCase].run();
+
+              std::ofstream out( results );
+              save( out );
+              out.flush();
+              if( out )   status = EXIT_SUCCESS;
+            }
+            catch( ... ) {}
+
+            std::_Exit( status );                                              // skip static destructors, they belong to the parent
+          }
+
+          if( pid < 0 )
+          {
+            std::clog << "  unable to start " << cases[nextCase].group << "'s " << cases[nextCase].name << '\n';
+            ++failures;
+          }
+          else
+          {
+            running.push_back( { pid, nextCase, core, results, std::chrono::steady_clock::now() } );
+            freeCores.pop_back();
+          }
+          ++nextCase;
+        }
+
+
+        // Wait for one of them to finish, and collect its results.  Only the workers started here are waited on, as other children
+        // of this process belong to whoever started them.  Cases take seconds, so looking every few milliseconds costs nothing.
+        if( running.empty() )   continue;
+
+        auto worker    = running.end();
+        bool succeeded = false;
+        while( worker == running.end() )
+        {
+          for( auto w = running.begin(); w != running.end()  &&  worker == running.end(); ++w )
+          {
+            int   status   = 0;
+            pid_t finished = waitpid( w->pid, &status, WNOHANG );
+            if( finished < 0  &&  errno == EINTR )   continue;
+            if( finished == 0 )                      continue;                 // still running
+
+            worker    = w;                                                      // finished, or somehow already reaped
+            succeeded = finished == w->pid  &&  WIFEXITED( status )  &&  WEXITSTATUS( status ) == EXIT_SUCCESS;
+          }
+          if( worker == running.end() )   std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+        }
+
+        auto const & thisCase = cases[worker->caseIndex];
+        auto         elapsed  = std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - worker->started );
+
+        if( succeeded )
+        {
+          std::ifstream in( worker->results );
+          merge( in );
+          std::clog << "  finished " << thisCase.group << "'s " << thisCase.name << " on core " << worker->core
+                    << " in " << elapsed.count() << " milliseconds (ms)\n";
+        }
+        else
+        {
+          std::clog << "  FAILED " << thisCase.group << "'s " << thisCase.name << " on core " << worker->core << '\n';
+          ++failures;
+        }
+
+        std::error_code ignored;
+        std::filesystem::remove( worker->results, ignored );
+        freeCores.push_back( worker->core );
+        running.erase( worker );
+      }
+
+      return failures;
+    #endif
+  }
+}  // namespace Benchmark
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>      // size_t
+#include <functional>   // function
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+
+
+
+namespace Benchmark
+{
+  // One independently runnable measurement, e.g. "Insert at the back" of a "Vector".  Cases in the same group are reported together.
+  struct Case
+  {
+    std::string           group;
+    std::string           name;
+    std::function<void()> run;
+  };
+
+
+
+  // Runs every case, in order, in this process.  While a Utilities::TraceSession is alive, each case is recorded as a trace event.
+  void runInProcess( std::vector<Case> const & cases );
+
+
+  // Runs every case in its own forked child process, up to workers at a time, each pinned to a core of its own.  Children are
+  // forked from this process as it is when they start, so nothing one case allocates or frees can affect another.  That includes
+  // the results merged from children already finished, so each child first calls reset() to discard them.  Then, after running its
+  // case, each child calls save() to write its results, and the parent passes them to merge() once that child finishes.
+  //
+  // Where fork() and sched_setaffinity() aren't available (anything but Linux), this falls back to runInProcess() and reset(),
+  // save(), and merge() aren't called.  Returns the number of cases that failed to complete.
+  std::size_t runIsolated( std::vector<Case> const &                     cases,
+                           std::size_t                                   workers,
+                           std::function<void()>                 const & reset,
+                           std::function<void( std::ostream & )> const & save,
+                           std::function<void( std::istream & )> const & merge );
+}  // namespace Benchmark
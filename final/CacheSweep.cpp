@@ -0,0 +1,173 @@
+#include <algorithm>    // find_if(), min(), shuffle()
+#include <chrono>       // steady_clock, duration
+#include <cmath>        // pow(), round()
+#include <cstddef>      // size_t
+#include <forward_list>
+#include <iomanip>      // setprecision()
+#include <iostream>
+#include <list>
+#include <map>
+#include <random>       // default_random_engine
+#include <string>       // to_string()
+#include <unordered_map>
+#include <utility>      // move(), pair
+#include <vector>
+
+#ifdef __linux__
+  #include <unistd.h>   // sysconf()
+#endif
+
+#include "Book.hpp"
+#include "CacheSweep.hpp"
+
+
+
+
+
+namespace    // unnamed, anonymous namespace
+{
+  using Clock = std::chrono::steady_clock;                                    // every measurement spans a whole container, so the clock's own cost is noise
+
+  constexpr std::size_t MIN_ELEMENTS     = 1'000;
+  constexpr double      STEPS_PER_DECADE = 4.0;
+  constexpr std::size_t WORK_PER_POINT   = 2'000'000;                         // small containers are refilled until at least this many elements are processed
+
+  volatile std::size_t sink = 0;                                              // results land here so the visits can't be optimized away
+
+
+
+  std::string isbnFor( std::size_t i )                                        // unique, and as long as a real ISBN-13
+  {
+    auto digits = std::to_string( i );
+    return std::string( 13 - std::min<std::size_t>( 13, digits.size() ), '0' ) + digits;
+  }
+
+  std::size_t heapBytes( std::string const & text )                           // beyond the small string buffer, if any
+  {
+    return text.capacity() >= sizeof( std::string ) ? text.capacity() + 1 : 0;
+  }
+
+  std::size_t physicalMemory()                                                // zero if unknown
+  {
+    #ifdef __linux__
+      auto pages = sysconf( _SC_PHYS_PAGES ),
+           size  = sysconf( _SC_PAGE_SIZE  );
+      if( pages > 0  &&  size > 0 )   return static_cast<std::size_t>( pages ) * static_cast<std::size_t>( size );
+    #endif
+    return 0;
+  }
+
+
+
+  // Times fill() then visit() on the container it returns, repeating small sizes, and returns nanoseconds per element for each.
+  // Destroying the container isn't timed.
+  template<class Fill, class Visit>
+  std::pair<double, double> timePerElement( std::size_t elements, Fill fill, Visit visit )
+  {
+    std::size_t     repetitions = std::max<std::size_t>( 1, WORK_PER_POINT / elements );
+    Clock::duration filling     = {};
+    Clock::duration visiting    = {};
+
+    for( std::size_t i = 0; i < repetitions; ++i )
+    {
+      auto start     = Clock::now();
+      auto container = fill();
+      auto middle    = Clock::now();
+      visit( container );
+      auto stop      = Clock::now();
+
+      filling  += middle - start;
+      visiting += stop   - middle;
+    }
+
+    auto perElement = [&]( Clock::duration total ) { return std::chrono::duration<double, std::nano>( total ).count() / static_cast<double>( repetitions * elements ); };
+    return { perElement( filling ), perElement( visiting ) };
+  }
+}    // unnamed, anonymous namespace
+
+
+
+
+
+
+
+
+namespace Benchmark
+{
+  void runCacheSweep( std::vector<Book> const & samples, std::size_t maxElements, std::ostream & csv )
+  {
+    std::vector<Book>        pool;                                            // the elements, resampled from samples
+    std::vector<std::string> keys;                                            // their ISBNs, shuffled, for lookups
+    std::size_t              poolHeapBytes = 0;
+    std::default_random_engine random;
+
+    csv << "Elements,Book MB"
+        << ",Vector/Fill,Vector/Scan,DLL/Fill,DLL/Scan,SLL/Fill,SLL/Scan,BST/Fill,BST/Lookup,Hash Table/Fill,Hash Table/Lookup"
+        << "  (nanoseconds per element)\n";
+
+    for( double step = 0.0; ; ++step )
+    {
+      auto elements = static_cast<std::size_t>( std::round( static_cast<double>( MIN_ELEMENTS ) * std::pow( 10.0, step / STEPS_PER_DECADE ) ) );
+      if( elements > maxElements )   break;
+
+      while( pool.size() < elements )
+      {
+        auto i    = pool.size();
+        Book book = samples.empty() ? Book( "Synthesized title number " + std::to_string( i ), "Synthesized author" ) : samples[i % samples.size()];
+        book.isbn( isbnFor( i ) );
+
+        poolHeapBytes += heapBytes( book.isbn() ) + heapBytes( book.title() ) + heapBytes( book.author() );
+        pool.push_back( std::move( book ) );
+      }
+
+      // The pool, the keys, and the largest container (a tree node holds a Book and a key besides three pointers and a color)
+      // are all alive at once
+      double bookBytes     = static_cast<double>( sizeof( Book ) ) + static_cast<double>( poolHeapBytes ) / static_cast<double>( pool.size() );
+      double elementBytes  =2.0 * bookBytes + 2.0 * sizeof( std::string ) + 4.0 * sizeof( void * );
+      if( auto memory = physicalMemory();  memory != 0  &&  elementBytes * static_cast<double>( elements ) > static_cast<double>( memory ) / 2.0 )
+      {
+        std::clog << "  stopping before " << elements << " elements, they'd need more than half of physical memory\n";
+        break;
+      }
+
+      keys.clear();
+      for( auto const & book : pool )   keys.push_back( book.isbn() );
+      std::shuffle( keys.begin(), keys.end(), random );
+
+      std::clog << "  sweeping " << elements << " elements ... ";
+
+
+      auto const first = pool.cbegin(),
+                 last  = pool.cbegin() + static_cast<std::ptrdiff_t>( elements );
+      auto const notThere = []( Book const & book ) { return book.isbn() == "non-existent"; };
+
+      std::vector<std::pair<double, double>> results;
+
+      results.push_back( timePerElement( elements,
+          [&] { std::vector<Book> v;  for( auto i = first; i != last; ++i ) v.push_back( *i );  return v; },
+          [&]( auto & v ) { sink = sink + static_cast<std::size_t>( std::find_if( v.begin(), v.end(), notThere ) == v.end() ); } ) );
+
+      results.push_back( timePerElement( elements,
+          [&] { std::list<Book> dll;  for( auto i = first; i != last; ++i ) dll.push_back( *i );  return dll; },
+          [&]( auto & dll ) { sink = sink + static_cast<std::size_t>( std::find_if( dll.begin(), dll.end(), notThere ) == dll.end() ); } ) );
+
+      results.push_back( timePerElement( elements,
+          [&] { std::forward_list<Book> sll;  auto tail = sll.before_begin();  for( auto i = first; i != last; ++i ) tail = sll.insert_after( tail, *i );  return sll; },
+          [&]( auto & sll ) { sink = sink + static_cast<std::size_t>( std::find_if( sll.begin(), sll.end(), notThere ) == sll.end() ); } ) );
+
+      results.push_back( timePerElement( elements,
+          [&] { std::map<std::string, Book> bst;  for( auto i = first; i != last; ++i ) bst.emplace( i->isbn(), *i );  return bst; },
+          [&]( auto & bst ) { std::size_t found = 0;  for( std::size_t k = 0; k < elements; ++k ) found += bst.count( keys[k] );  sink = sink + found; } ) );
+
+      results.push_back( timePerElement( elements,
+          [&] { std::unordered_map<std::string, Book> hashTable;  for( auto i = first; i != last; ++i ) hashTable.emplace( i->isbn(), *i );  return hashTable; },
+          [&]( auto & hashTable ) { std::size_t found = 0;  for( std::size_t k = 0; k < elements; ++k ) found += hashTable.count( keys[k] );  sink = sink + found; } ) );
+
+
+      csv << elements << ',' << std::fixed << std::setprecision( 1 ) << bookBytes * static_cast<double>( elements ) / 1e6 << std::setprecision( 2 );
+      for( auto const & [fill, visit] : results )   csv << ',' << fill << ',' << visit;
+      csv << std::defaultfloat << std::endl;                                  // flushed, so a long sweep can be watched as it goes
+      std::clog << "done\n";
+    }
+  }
+}  // namespace Benchmark
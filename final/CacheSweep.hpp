@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>      // size_t
+#include <iostream>
+#include <vector>
+
+#include "Book.hpp"
+
+
+
+
+
+namespace Benchmark
+{
+  // Grows each container to a series of sizes, four per decade from 1,000 up to maxElements, and at each size times filling it and
+  // then visiting every element (a full scan of the sequences, a lookup of every key in the trees and hash tables).  Reported as
+  // nanoseconds per element, so the cliffs where a container stops fitting in L1, L2, the last level cache, and finally the TLB's
+  // reach stand out as steps in an otherwise flat line.
+  //
+  // Elements are resampled from samples, each with a unique ISBN, so they're the size and shape of real books.  Sizes that would
+  // need more than half of this machine's physical memory are skipped.
+  void runCacheSweep( std::vector<Book> const & samples, std::size_t maxElements, std::ostream & csv );
+}  // namespace Benchmark
@@ -0,0 +1,194 @@
+/***********************************************************************************************************************************
+** Class LatencyHistogramType - A fixed size, log-linear histogram of latencies in the style of Gil Tene's HdrHistogram.  Values
+**                              below 2^SignificantBits are counted exactly.  Above that, every power of two range is split into
+**                              2^(SignificantBits-1) equal width buckets, so any recorded value is known to within a relative
+**                              error of 2^-(SignificantBits-1) (about 6% by default) no matter how large it is.
+**
+**      LatencyHistogram h;
+**      h.record( stop - start );                // O(1), no allocation
+**      h += otherThreadsHistogram;              // histograms of the same type merge by adding counts
+**      h.percentile( 99.9 );                    // the tail, in nanoseconds
+**
+**  Values at or beyond 2^RangeBits nanoseconds (about 18 minutes by default) are counted in the last bucket, but max() still
+**  reports them exactly.  Histograms are written and read back in a compact text form, so those recorded in separate processes
+**  can be merged too.
+**
+***********************************************************************************************************************************/
+#pragma once
+
+#include <algorithm>    // clamp(), max(), min()
+#include <array>
+#include <bit>          // bit_width()
+#include <chrono>       // duration, duration_cast<>(), nanoseconds
+#include <cmath>        // abs(), ceil(), erfc(), sqrt()
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <iostream>
+#include <limits>       // numeric_limits
+
+
+
+
+
+namespace Utilities
+{
+  template<unsigned SignificantBits = 5, unsigned RangeBits = 40>
+  class LatencyHistogramType
+  {
+    static_assert( 1 < SignificantBits  &&  SignificantBits < RangeBits  &&  RangeBits < 64 );
+
+    public:
+      // Record a sample.  Negative durations, possible when a clock is read on two different cores, are recorded as zero.
+      template<class Rep, class Period>
+      void record( std::chrono::duration<Rep, Period> sample ) noexcept
+      {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>( sample ).count();
+        record( ns < 0 ? std::uint64_t{ 0 } : static_cast<std::uint64_t>( ns ) );
+      }
+
+      void record( std::uint64_t nanoseconds ) noexcept
+      {
+        ++_counts[indexOf( nanoseconds )];
+        ++_count;
+        _min = std::min( _min, nanoseconds );
+        _max = std::max( _max, nanoseconds );
+      }
+
+      LatencyHistogramType & operator+=( LatencyHistogramType const & rhs ) noexcept
+      {
+        for( std::size_t i = 0; i < BUCKETS; ++i ) _counts[i] += rhs._counts[i];
+        _count += rhs._count;
+        _min    = std::min( _min, rhs._min );
+        _max    = std::max( _max, rhs._max );
+        return *this;
+      }
+
+
+      std::uint64_t count() const noexcept { return _count;                  }
+      std::uint64_t min  () const noexcept { return _count == 0 ? 0 : _min;  }
+      std::uint64_t max  () const noexcept { return _max;                    }
+
+      // Smallest value such that at least percent of the samples are at or below it, reported as the highest value its bucket
+      // could hold (never more than max()).  Zero if nothing's been recorded.
+      std::uint64_t percentile( double percent ) const noexcept
+      {
+        if( _count == 0 )   return 0;
+
+        auto rank = static_cast<std::uint64_t>( std::ceil( percent / 100.0 * static_cast<double>( _count ) ) );
+        rank      = std::clamp( rank, std::uint64_t{ 1 }, _count );
+
+        std::uint64_t seen = 0;
+        for( std::size_t i = 0; i < BUCKETS; ++i )
+        {
+          seen += _counts[i];
+          if( seen >= rank )   return i + 1 == BUCKETS ? _max : std::min( highestEquivalent( i ), _max );     // the last bucket has no upper bound
+        }
+        return _max;
+      }
+
+
+      // Mann-Whitney U test of whether two histograms' samples could have come from the same distribution, with samples in the
+      // same bucket counted as ties.  probabilityGreater is the chance a random sample from rhs exceeds a random sample from lhs
+      // (0.5 when neither tends to be larger), and pValue is two sided, from the normal approximation with a tie correction.
+      struct Comparison
+      {
+        double probabilityGreater = 0.5;
+        double pValue             = 1.0;
+      };
+
+      friend Comparison compare( LatencyHistogramType const & lhs, LatencyHistogramType const & rhs ) noexcept
+      {
+        if( lhs._count == 0  ||  rhs._count == 0 )   return {};
+
+        double n1 = static_cast<double>( lhs._count ),
+               n2 = static_cast<double>( rhs._count ),
+               n  = n1 + n2;
+
+        double u        = 0.0;                                                                    // pairs with rhs's sample the larger, ties counting half
+        double lhsBelow = 0.0;
+        double ties     = 0.0;                                                                    // sum of t^3 - t over groups of t tied samples
+        for( std::size_t i = 0; i < BUCKETS; ++i )
+        {
+          double a = static_cast<double>( lhs._counts[i] ),
+                 b = static_cast<double>( rhs._counts[i] ),
+                 t = a + b;
+
+          u        += b * ( lhsBelow + a / 2.0 );
+          lhsBelow += a;
+          ties     += t * t * t - t;
+        }
+
+        double variance = n1 * n2 / 12.0 * ( ( n + 1.0 ) - ties / ( n * ( n - 1.0 ) ) );
+        if( variance <= 0.0 )   return { u / ( n1 * n2 ), 1.0 };                                  // every sample tied
+
+        double z = ( u - n1 * n2 / 2.0 ) / std::sqrt( variance );
+        return { u / ( n1 * n2 ), std::erfc( std::abs( z ) / std::sqrt( 2.0 ) ) };
+      }
+
+
+      // Insertion and Extraction Operators.  Only non-empty buckets are written, as (index, count) pairs.
+      friend std::ostream & operator<<( std::ostream & stream, LatencyHistogramType const & histogram )
+      {
+        std::size_t used = 0;
+        for( auto count : histogram._counts )   if( count != 0 ) ++used;
+
+        stream << histogram._count << ' ' << histogram._min << ' ' << histogram._max << ' ' << used;
+        for( std::size_t i = 0; i < BUCKETS; ++i )   if( histogram._counts[i] != 0 ) stream << ' ' << i << ' ' << histogram._counts[i];
+        return stream;
+      }
+
+      friend std::istream & operator>>( std::istream & stream, LatencyHistogramType & histogram )
+      {
+        LatencyHistogramType result;
+        std::size_t          used = 0;
+        if( !( stream >> result._count >> result._min >> result._max >> used ) )   return stream;
+
+        for( std::size_t i = 0; i < used; ++i )
+        {
+          std::size_t index;
+          if( !( stream >> index )  ||  index >= BUCKETS  ||  !( stream >> result._counts[index] ) )
+          {
+            stream.setstate( std::ios::failbit );
+            return stream;
+          }
+        }
+
+        histogram = result;
+        return stream;
+      }
+
+
+    private:
+      inline static constexpr std::size_t SUB_BUCKETS = std::size_t{ 1 } << SignificantBits;      // exact values below this
+      inline static constexpr std::size_t HALF        = SUB_BUCKETS / 2;                          // buckets per power of two above it
+      inline static constexpr std::size_t BUCKETS     = SUB_BUCKETS + ( RangeBits - SignificantBits ) * HALF;
+
+      // Values of bit width w > SignificantBits are shifted right by w - SignificantBits, leaving their top SignificantBits bits,
+      // which always start with a one.  The rest select one of HALF buckets in that power of two's range.
+      static std::size_t indexOf( std::uint64_t value ) noexcept
+      {
+        value = std::min( value, ( std::uint64_t{ 1 } << RangeBits ) - 1 );
+        if( value < SUB_BUCKETS )   return value;
+
+        std::size_t shift = std::bit_width( value ) - SignificantBits;
+        return SUB_BUCKETS + ( shift - 1 ) * HALF + ( value >> shift ) - HALF;
+      }
+
+      static std::uint64_t highestEquivalent( std::size_t index ) noexcept
+      {
+        if( index < SUB_BUCKETS )   return index;
+
+        auto shift = ( index - SUB_BUCKETS ) / HALF + 1;
+        auto top   = ( index - SUB_BUCKETS ) % HALF + HALF;
+        return ( ( top + 1 ) << shift ) - 1;
+      }
+
+
+      std::array<std::uint64_t, BUCKETS> _counts = {};
+      std::uint64_t                      _count  = 0;
+      std::uint64_t                      _min    = std::numeric_limits<std::uint64_t>::max();
+      std::uint64_t                      _max    = 0;
+  };
+
+  using LatencyHistogram = LatencyHistogramType<>;
+}  // namespace Utilities
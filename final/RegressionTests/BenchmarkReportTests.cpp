@@ -0,0 +1,122 @@
+#include <cstddef>     // size_t
+#include <cstdint>     // uint64_t
+#include <exception>
+#include <iomanip>     // setprecision()
+#include <iostream>    // boolalpha(), showpoint(), fixed()
+#include <sstream>
+#include <string>
+
+#include "BenchmarkReport.hpp"
+#include "CheckResults.hpp"
+
+
+
+
+namespace  // anonymous
+{
+  class BenchmarkReportRegressionTest
+  {
+    public:
+      BenchmarkReportRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_benchmarkReport_tests;
+
+
+
+
+  // A two cell report of one operation, each sample scaled by percent
+  Benchmark::Report reportOf( std::uint64_t percent )
+  {
+    Benchmark::Report report;
+    report.metadata = { { "compiler", "g++ \"12\"\\n" }, { "seed", "42" } };
+
+    for( std::size_t size : { 250U, 500U } )
+    {
+      Benchmark::Cell cell{ size, "Vector", "Insert at the back", 0, {} };
+      for( std::uint64_t value = 100; value < 600; ++value )
+      {
+        cell.latencies.record( value * percent / 100 );
+        cell.totalNS += static_cast<std::int64_t>( value * percent / 100 );
+      }
+      report.cells.push_back( cell );
+    }
+    return report;
+  }
+
+
+
+
+  void BenchmarkReportRegressionTest::tests()
+  {
+    {
+      auto              written = reportOf( 100 );
+      std::stringstream json;
+      Benchmark::writeJson( json, written );
+      auto read = Benchmark::readJson( json );
+
+      bool sameCells = read.cells.size() == written.cells.size();
+      for( std::size_t i = 0; sameCells  &&  i < read.cells.size(); ++i )
+      {
+        auto const & lhs = written.cells[i];
+        auto const & rhs = read.cells[i];
+        sameCells = lhs.size == rhs.size  &&  lhs.structure == rhs.structure  &&  lhs.operation == rhs.operation  &&  lhs.totalNS == rhs.totalNS
+                &&  lhs.latencies.count() == rhs.latencies.count()  &&  lhs.latencies.max() == rhs.latencies.max()
+                &&  lhs.latencies.percentile( 50 ) == rhs.latencies.percentile( 50 )  &&  lhs.latencies.percentile( 99 ) == rhs.latencies.percentile( 99 );
+      }
+
+      affirm.is_true( "JSON round trip - metadata, escapes included", read.metadata == written.metadata );
+      affirm.is_true( "JSON round trip - cells and histograms",       sameCells );
+    }
+
+    {
+      std::ostringstream table;
+      affirm.is_equal( "Compare - identical runs, no regression", 0U, Benchmark::compare( reportOf( 100 ), reportOf( 100 ), table ) );
+      affirm.is_true ( "Compare - identical runs, no change",     table.str().find( "no significant change" ) != std::string::npos );
+    }
+
+    {
+      std::ostringstream table;
+      affirm.is_equal( "Compare - slower candidate, one regression", 1U, Benchmark::compare( reportOf( 100 ), reportOf( 150 ), table ) );
+      affirm.is_true ( "Compare - slower candidate, verdict",        table.str().find( "REGRESSION" ) != std::string::npos );
+
+      std::ostringstream faster;
+      Benchmark::compare( reportOf( 150 ), reportOf( 100 ), faster );
+      affirm.is_true ( "Compare - faster candidate, improvement",    faster.str().find( "improvement" ) != std::string::npos );
+    }
+
+    {
+      // A case that crashed left nothing in the candidate, which must fail the comparison as a regression would
+      auto missing = reportOf( 100 );
+      for( auto & cell : missing.cells ) cell.operation = "Insert at the front";
+
+      std::ostringstream table;
+      affirm.is_equal( "Compare - missing from the candidate, a failure", 1U, Benchmark::compare( reportOf( 100 ), missing, table ) );
+      affirm.is_true ( "Compare - missing from the candidate, verdict",   table.str().find( "MISSING" ) != std::string::npos );
+    }
+  }
+
+
+
+  BenchmarkReportRegressionTest::BenchmarkReportRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nBenchmark Report Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"Benchmark report\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
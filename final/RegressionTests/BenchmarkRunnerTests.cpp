@@ -0,0 +1,147 @@
+#include <cstddef>     // size_t
+#include <cstdlib>     // abort(), _Exit()
+#include <exception>
+#include <filesystem>  // temp_directory_path(), remove()
+#include <fstream>
+#include <iomanip>     // setprecision()
+#include <iostream>    // boolalpha(), showpoint(), fixed()
+#include <iterator>    // istreambuf_iterator
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+  #include <sys/wait.h>  // waitpid(), WIFEXITED(), WEXITSTATUS()
+  #include <unistd.h>    // fork()
+#endif
+
+#include "BenchmarkRunner.hpp"
+#include "CheckResults.hpp"
+#include "TraceTimer.hpp"
+
+
+
+
+namespace  // anonymous
+{
+  class BenchmarkRunnerRegressionTest
+  {
+    public:
+      BenchmarkRunnerRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_benchmarkRunner_tests;
+
+
+
+
+  std::size_t occurrences( std::string const & text, std::string const & pattern )
+  {
+    std::size_t count = 0;
+    for( auto at = text.find( pattern ); at != std::string::npos; at = text.find( pattern, at + pattern.size() ) ) ++count;
+    return count;
+  }
+
+
+
+
+  void BenchmarkRunnerRegressionTest::tests()
+  {
+    {
+      std::size_t                  runs  = 0;
+      std::vector<Benchmark::Case> cases = { { "Vector", "Insert at the back", [&]() noexcept { ++runs; } },
+                                             { "Vector", "Remove",             [&]() noexcept { ++runs; } } };
+
+      auto filename = ( std::filesystem::temp_directory_path() / "BenchmarkRunnerRegressionTest.json" ).string();
+      {
+        Utilities::TraceSession session( filename );
+        Benchmark::runInProcess( cases );
+      }
+
+      std::ifstream fin( filename );
+      std::string   trace( std::istreambuf_iterator<char>( fin ), {} );
+      fin.close();
+      std::filesystem::remove( filename );
+
+      affirm.is_equal( "In process - every case run",           2U, runs );
+      affirm.is_equal( "In process - each case traced",         1U, occurrences( trace, "\"name\":\"Vector's Insert at the back\"" ) );
+      affirm.is_equal( "In process - each case traced, again",  1U, occurrences( trace, "\"name\":\"Vector's Remove\""             ) );
+    }
+
+    {
+      // Each case counts itself once.  One worker runs them one after another, so the second child is forked after the first's
+      // count is merged, and without reset() would save and merge it again.
+      std::map<std::string, std::size_t> counts;
+      std::vector<Benchmark::Case>       cases = { { "Vector", "Insert at the back", [&] { ++counts["Insert at the back"]; } },
+                                                   { "Vector", "Remove",             [&] { ++counts["Remove"];             } } };
+
+      auto failures = Benchmark::runIsolated( cases, 1,
+                                              [&](                        ) noexcept { counts.clear(); },
+                                              [&]( std::ostream & results ) { for( auto const & [name, count] : counts ) results << name << '\t' << count << '\n'; },
+                                              [&]( std::istream & results )
+                                              {
+                                                std::string name;
+                                                std::size_t count;
+                                                while( std::getline( results, name, '\t' )  &&  results >> count  &&  results.ignore() ) counts[name] += count;
+                                              } );
+
+      affirm.is_equal( "Isolated - every case completed",     0U, failures                     );
+      affirm.is_equal( "Isolated - first case merged once",   1U, counts["Insert at the back"] );
+      affirm.is_equal( "Isolated - second case merged once",  1U, counts["Remove"]             );
+    }
+
+    #ifdef __linux__
+    {
+      // A case that crashes is counted as failed and the rest still run.  Another child of this process, one the runner didn't
+      // start, is left for its own parent to wait for.
+      pid_t bystander = fork();
+      if( bystander == 0 )   std::_Exit( 7 );
+
+      std::map<std::string, std::size_t> counts;
+      std::vector<Benchmark::Case>       cases = { { "Vector", "Crash",  []() noexcept { std::abort(); } },
+                                                   { "Vector", "Remove", [&]          { ++counts["Remove"]; } } };
+
+      auto failures = Benchmark::runIsolated( cases, 1,
+                                              [&](                        ) noexcept { counts.clear(); },
+                                              [&]( std::ostream & results ) { for( auto const & [name, count] : counts ) results << name << '\t' << count << '\n'; },
+                                              [&]( std::istream & results )
+                                              {
+                                                std::string name;
+                                                std::size_t count;
+                                                while( std::getline( results, name, '\t' )  &&  results >> count  &&  results.ignore() ) counts[name] += count;
+                                              } );
+
+      int  status        = 0;
+      bool bystanderLeft = bystander > 0  &&  waitpid( bystander, &status, 0 ) == bystander  &&  WIFEXITED( status )  &&  WEXITSTATUS( status ) == 7;
+
+      affirm.is_equal( "Isolated - crashed case failed",             1U, failures         );
+      affirm.is_equal( "Isolated - case after the crash merged",     1U, counts["Remove"] );
+      affirm.is_true ( "Isolated - other children left to wait for",     bystanderLeft    );
+    }
+    #endif
+  }
+
+
+
+  BenchmarkRunnerRegressionTest::BenchmarkRunnerRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nBenchmark Runner Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"Benchmark runner\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
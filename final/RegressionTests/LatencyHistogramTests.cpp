@@ -0,0 +1,140 @@
+#include <chrono>      // nanoseconds, microseconds
+#include <cstdint>     // uint64_t
+#include <exception>
+#include <iomanip>     // setprecision()
+#include <iostream>    // boolalpha(), showpoint(), fixed()
+#include <sstream>
+
+#include "CheckResults.hpp"
+#include "LatencyHistogram.hpp"
+
+
+
+
+namespace  // anonymous
+{
+  class LatencyHistogramRegressionTest
+  {
+    public:
+      LatencyHistogramRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_latencyHistogram_tests;
+
+
+
+
+  void LatencyHistogramRegressionTest::tests()
+  {
+    using Utilities::LatencyHistogram;
+
+    {
+      LatencyHistogram empty;
+      affirm.is_equal( "Empty - count",      std::uint64_t{ 0 }, empty.count()           );
+      affirm.is_equal( "Empty - percentile", std::uint64_t{ 0 }, empty.percentile( 50 )  );
+    }
+
+    {
+      LatencyHistogram small;
+      for( std::uint64_t value = 1; value <= 20; ++value ) small.record( value );
+
+      affirm.is_equal( "Small values are exact - p50", std::uint64_t{ 10 }, small.percentile( 50 ) );
+      affirm.is_equal( "Small values are exact - p90", std::uint64_t{ 18 }, small.percentile( 90 ) );
+      affirm.is_equal( "Small values are exact - min", std::uint64_t{  1 }, small.min()            );
+      affirm.is_equal( "Small values are exact - max", std::uint64_t{ 20 }, small.max()            );
+    }
+
+    {
+      // One slow sample in a thousand, like a vector reallocating, has to show in the tail but not the median
+      LatencyHistogram h;
+      for( int i = 0; i < 999; ++i ) h.record( std::chrono::nanoseconds( 100 ) );
+      h.record( std::chrono::microseconds( 250 ) );
+
+      auto p50  = h.percentile( 50    );
+      auto p99  = h.percentile( 99    );
+      auto tail = h.percentile( 99.95 );
+
+      affirm.is_true ( "Tail latency - p50 within bucket precision", 100 <= p50  &&  p50 < 107 );
+      affirm.is_true ( "Tail latency - p99 unaffected by the outlier", p99 < 107 );
+      affirm.is_equal( "Tail latency - outlier at the very top",     std::uint64_t{ 250'000 }, tail    );
+      affirm.is_equal( "Tail latency - max is exact",                std::uint64_t{ 250'000 }, h.max() );
+    }
+
+    {
+      LatencyHistogram all, firstHalf, secondHalf;
+      for( std::uint64_t value = 0; value < 10'000; value += 7 )
+      {
+        all.record( value );
+        ( value < 5'000 ? firstHalf : secondHalf ).record( value );
+      }
+      firstHalf += secondHalf;
+
+      bool same = firstHalf.count() == all.count()  &&  firstHalf.min() == all.min()  &&  firstHalf.max() == all.max();
+      for( double percent : { 1.0, 25.0, 50.0, 75.0, 99.0, 99.9 } ) same = same  &&  firstHalf.percentile( percent ) == all.percentile( percent );
+      affirm.is_true( "Merge - same as recording everything in one", same );
+
+      std::stringstream stream;
+      LatencyHistogram  copy;
+      stream << all;
+      stream >> copy;
+      bool restored = copy.count() == all.count()  &&  copy.min() == all.min()  &&  copy.max() == all.max();
+      for( double percent : { 1.0, 25.0, 50.0, 75.0, 99.0, 99.9 } ) restored = restored  &&  copy.percentile( percent ) == all.percentile( percent );
+      affirm.is_true( "Text round trip - same percentiles", restored );
+    }
+
+    {
+      LatencyHistogram h;
+      h.record( std::chrono::nanoseconds( -5 ) );
+      h.record( std::chrono::hours( 1 ) );
+      affirm.is_equal( "Out of range - negative recorded as zero", std::uint64_t{ 0 },                 h.percentile( 50  ) );
+      affirm.is_equal( "Out of range - huge still exact max",      std::uint64_t{ 3'600'000'000'000 }, h.percentile( 100 ) );
+    }
+
+    {
+      // Same samples on both sides:  nothing to tell them apart
+      LatencyHistogram before, after;
+      for( std::uint64_t value = 100; value < 1'100; ++value ) { before.record( value );  after.record( value ); }
+      auto same = compare( before, after );
+      affirm.is_true( "Mann-Whitney - identical, p near 1",           same.pValue > 0.99 );
+      affirm.is_true( "Mann-Whitney - identical, neither larger",     0.49 < same.probabilityGreater  &&  same.probabilityGreater < 0.51 );
+
+      // Every sample 30% slower
+      LatencyHistogram slower;
+      for( std::uint64_t value = 100; value < 1'100; ++value ) slower.record( value * 13 / 10 );
+      auto shifted = compare( before, slower );
+      affirm.is_true( "Mann-Whitney - shifted, significant",          shifted.pValue < 0.01 );
+      affirm.is_true( "Mann-Whitney - shifted, rhs tends larger",     shifted.probabilityGreater > 0.6 );
+
+      // Every sample in one bucket, so the tie corrected variance is zero
+      LatencyHistogram tied, alsoTied;
+      for( int i = 0; i < 50; ++i ) { tied.record( std::uint64_t{ 7 } );  alsoTied.record( std::uint64_t{ 7 } ); }
+      auto allTied = compare( tied, alsoTied );
+      affirm.is_equal( "Mann-Whitney - all tied, p is 1",             1.0, allTied.pValue             );
+      affirm.is_equal( "Mann-Whitney - all tied, neither larger",     0.5, allTied.probabilityGreater );
+    }
+  }
+
+
+
+  LatencyHistogramRegressionTest::LatencyHistogramRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nLatency Histogram Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class LatencyHistogram\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
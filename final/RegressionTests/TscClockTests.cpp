@@ -0,0 +1,92 @@
+#include <chrono>      // steady_clock, milliseconds, duration_cast<>()
+#include <exception>
+#include <iomanip>     // setprecision()
+#include <iostream>    // boolalpha(), showpoint(), fixed()
+#include <thread>      // this_thread::sleep_for()
+
+#include "CheckResults.hpp"
+#include "Timer.hpp"
+#include "TscClock.hpp"
+
+
+
+
+namespace  // anonymous
+{
+  class TscClockRegressionTest
+  {
+    public:
+      TscClockRegressionTest();
+
+    private:
+      void tests();
+
+      Regression::CheckResults affirm;
+  } run_tscClock_tests;
+
+
+
+
+  void TscClockRegressionTest::tests()
+  {
+    using namespace std::chrono_literals;
+    using Utilities::TscClock;
+
+    {
+      bool steady   = true;
+      auto previous = TscClock::now();
+      for( int i = 0; i < 100'000; ++i )
+      {
+        auto current = TscClock::now();
+        steady       = steady && previous <= current;
+        previous     = current;
+      }
+      affirm.is_true( "Never goes backwards", steady );
+    }
+
+    {
+      auto tscStart    = TscClock::now();
+      auto steadyStart = std::chrono::steady_clock::now();
+      std::this_thread::sleep_for( 50ms );
+      auto tscElapsed    = TscClock::now()                  - tscStart;
+      auto steadyElapsed = std::chrono::steady_clock::now() - steadyStart;
+
+      auto disagreement = tscElapsed > steadyElapsed ? tscElapsed - steadyElapsed : steadyElapsed - tscElapsed;
+      auto offset       = TscClock::now().time_since_epoch() - std::chrono::steady_clock::now().time_since_epoch();
+
+      affirm.is_true( "Measures a 50 ms sleep",      tscElapsed >= 49ms             );
+      affirm.is_true( "Agrees with steady_clock",    disagreement < 1ms             );
+      affirm.is_true( "Shares steady_clock's epoch", -1ms < offset && offset < 1ms  );
+    }
+
+    {
+      Utilities::TimerType<std::chrono::milliseconds, TscClock> timer;
+      std::this_thread::sleep_for( 20ms );
+      affirm.is_true( "Plugs into TimerType", timer >= 19 );
+    }
+
+    std::clog << "  (invariant TSC " << ( TscClock::invariant() ? "found, " : "not found, falling back to steady_clock, " )
+              << TscClock::ticksPerSecond() / 1e9 << " GHz)\n";
+  }
+
+
+
+  TscClockRegressionTest::TscClockRegressionTest()
+  {
+    std::clog << std::boolalpha << std::showpoint << std::fixed << std::setprecision( 2 );
+
+
+    try
+    {
+      std::clog << "\nTSC Clock Regression Test:\n";
+      tests();
+
+      std::clog << affirm << '\n';
+    }
+    catch( const std::exception & ex )
+    {
+      std::clog << "FAILURE:  Regression test for \"class TscClock\" failed with an unhandled exception. \n\n\n"
+                << ex.what() << std::endl;
+    }
+  }
+} // namespace
@@ -0,0 +1,154 @@
+/***********************************************************************************************************************************
+** Class TscClock - A steady clock read straight from the processor's time stamp counter (TSC).  It satisfies the standard Clock
+**                  requirements, so it plugs in wherever a std::chrono clock does:
+**
+**      Utilities::TimerType<std::chrono::nanoseconds, Utilities::TscClock> t;      // a Timer counting TSC ticks, or
+**      auto start = Utilities::TscClock::now();                                    // timing something directly
+**
+**  A steady_clock::now() call goes through the vDSO and costs tens of nanoseconds, more than many of the operations being
+**  measured.  Reading the TSC costs a few.  The tick rate is calibrated against steady_clock once, on first use, and time points
+**  share steady_clock's epoch.
+**
+**  The TSC is only a clock if it's invariant, i.e. ticks at a constant rate regardless of power state and frequency scaling.  On
+**  processors without an invariant TSC, and on non-x86 processors, TscClock quietly falls back to steady_clock.
+**
+***********************************************************************************************************************************/
+#pragma once
+
+#include <chrono>       // steady_clock, duration_cast<>(), time_point, nanoseconds
+#include <cstdint>      // int64_t, uint64_t
+#include <ratio>        // nano
+#include <thread>       // this_thread::sleep_for()
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+  #define UTILITIES_TSC_X86
+  #include <intrin.h>   // __rdtscp(), __cpuid(), _mm_lfence()
+#elif defined( __x86_64__ ) || defined( __i386__ )
+  #define UTILITIES_TSC_X86
+  #include <cpuid.h>    // __get_cpuid()
+  #include <x86intrin.h>// __rdtscp(), _mm_lfence()
+#endif
+
+
+
+
+
+namespace Utilities
+{
+  class TscClock
+  {
+    public:
+      using rep        = std::int64_t;
+      using period     = std::nano;
+      using duration   = std::chrono::nanoseconds;
+      using time_point = std::chrono::time_point<TscClock>;
+
+      inline static constexpr bool is_steady = true;
+
+
+      static time_point now() noexcept
+      {
+        auto const & calibration = calibrated();
+        if( !calibration.invariant )   return time_point( std::chrono::duration_cast<duration>( std::chrono::steady_clock::now().time_since_epoch() ) );
+
+        // Signed, so a core whose counter is a few ticks behind the calibrating core's yields a time just before the epoch
+        auto elapsedTicks = static_cast<std::int64_t>( ticks() - calibration.epochTicks );
+        return time_point( duration( calibration.epochNS + static_cast<rep>( static_cast<double>( elapsedTicks ) * calibration.nsPerTick ) ) );
+      }
+
+      static bool   invariant     () noexcept { return calibrated().invariant;                 }   // false if falling back to steady_clock
+      static double ticksPerSecond() noexcept { return 1'000'000'000.0 / calibrated().nsPerTick; }
+
+
+    private:
+      inline static constexpr std::chrono::milliseconds CALIBRATION_PERIOD{ 20 };                  // ~1 part per million at a typical 50 ns read error
+
+      struct Calibration
+      {
+        bool          invariant  = false;
+        std::uint64_t epochTicks = 0;                                                               // the TSC reading at ...
+        rep           epochNS    = 0;                                                               // ... this many ns past steady_clock's epoch
+        double        nsPerTick  = 1.0;
+      };
+
+
+      // rdtscp waits for every earlier instruction to finish before reading the counter, and the lfence keeps later instructions
+      // from starting before it's read, so nothing leaks into or out of the timed region.
+      static std::uint64_t ticks() noexcept
+      {
+        #ifdef UTILITIES_TSC_X86
+          unsigned int processor;
+          std::uint64_t count = __rdtscp( &processor );
+          _mm_lfence();
+          return count;
+        #else
+          return 0;
+        #endif
+      }
+
+      static bool hasInvariantTsc() noexcept
+      {
+        #if defined( UTILITIES_TSC_X86 ) && defined( _MSC_VER )
+          int registers[4];                                                                         // eax, ebx, ecx, edx
+          __cpuid( registers, static_cast<int>( 0x8000'0000 ) );
+          if( static_cast<unsigned int>( registers[0] ) < 0x8000'0007 )   return false;
+
+          __cpuid( registers, static_cast<int>( 0x8000'0001 ) );
+          bool rdtscp = registers[3] & ( 1 << 27 );
+          __cpuid( registers, static_cast<int>( 0x8000'0007 ) );
+          return rdtscp  &&  ( registers[3] & ( 1 << 8 ) );
+        #elif defined( UTILITIES_TSC_X86 )
+          unsigned int eax, ebx, ecx, edx;
+          if( __get_cpuid( 0x8000'0001, &eax, &ebx, &ecx, &edx ) == 0  ||  ( edx & ( 1U << 27 ) ) == 0 )   return false;    // rdtscp instruction
+          if( __get_cpuid( 0x8000'0007, &eax, &ebx, &ecx, &edx ) == 0  ||  ( edx & ( 1U << 8  ) ) == 0 )   return false;    // invariant TSC
+          return true;
+        #else
+          return false;
+        #endif
+      }
+
+
+      // Pairs a TSC reading with a steady_clock reading at each end of the calibration period.  The steady_clock read is bracketed
+      // by two TSC reads, and paired with their midpoint.
+      static Calibration calibrate() noexcept
+      {
+        Calibration result;
+        result.invariant = hasInvariantTsc();
+        if( !result.invariant )   return result;
+
+        auto sample = []( std::uint64_t & tsc, rep & ns )
+        {
+          auto before = ticks();
+          ns          = std::chrono::duration_cast<duration>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+          auto after  = ticks();
+          tsc         = before + ( after - before ) / 2;
+        };
+
+        std::uint64_t startTicks, stopTicks;
+        rep           startNS,    stopNS;
+
+        sample( startTicks, startNS );
+        std::this_thread::sleep_for( CALIBRATION_PERIOD );
+        sample( stopTicks,  stopNS  );
+
+        if( stopTicks <= startTicks  ||  stopNS <= startNS )                                        // the TSC isn't behaving like a clock after all
+        {
+          result.invariant = false;
+          return result;
+        }
+
+        result.epochTicks = startTicks;
+        result.epochNS    = startNS;
+        result.nsPerTick  = static_cast<double>( stopNS - startNS ) / static_cast<double>( stopTicks - startTicks );
+        return result;
+      }
+
+      // Calibrated on first use rather than during static initialization, so it's ready no matter which translation unit's
+      // static objects use it first.
+      static Calibration const & calibrated() noexcept
+      {
+        static const Calibration calibration = calibrate();
+        return calibration;
+      }
+  };
+}  // namespace Utilities
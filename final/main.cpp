@@ -1,21 +1,36 @@
-#include <algorithm>        // shuffle(), find(), find_if()
+#include <algorithm>        // shuffle(), find(), find_if(), max()
 #include <chrono>           // steady_clock, duration
 #include <concepts>         // convertible_to
 #include <cstddef>          // size_t
+#include <cstdint>          // uint64_t
+#include <cstdlib>          // EXIT_SUCCESS, EXIT_FAILURE
 #include <forward_list>     // Singly linked list
+#include <fstream>
 #include <iostream>         // standard i/o streams cout, clog, cin
 #include <iterator>         // next(), istream_iterator
 #include <list>             // doubly linked list
 #include <map>              // Binary search tree associative container with no duplicates
+#include <memory>           // unique_ptr, make_unique()
+#include <optional>
 #include <random>           // random_device, default_random_engine
 #include <sstream>          // ostringstream
-#include <string>           // Unbounded strings
+#include <stdexcept>        // invalid_argument, runtime_error
+#include <string>           // Unbounded strings, stoul(), stoull(), stod()
+#include <string_view>
+#include <thread>           // hardware_concurrency()
 #include <unordered_map>    // Hash Table associative container with no duplicates
+#include <utility>          // pair
 #include <vector>           // Unbounded vector
 
+#include "BenchmarkReport.hpp"
+#include "BenchmarkRunner.hpp"
 #include "Book.hpp"
+#include "CacheSweep.hpp"
+#include "LatencyHistogram.hpp"
 #include "Operations.hpp"
 #include "Timer.hpp"
+#include "TraceTimer.hpp"
+#include "TscClock.hpp"
 
 
 
@@ -34,8 +49,14 @@ namespace    // unnamed, anonymous namespace
   /*********************************************************************************************************************************
   **  Type Definitions
   *********************************************************************************************************************************/
-  // Preferred clock
-  using Clock = std::chrono::steady_clock;
+  // Preferred clock.  TscClock reads the processor's time stamp counter, a few nanoseconds instead of the tens a steady_clock::now()
+  // call costs, and falls back to steady_clock itself where there's no invariant TSC.  Compile with -DUSE_STEADY_CLOCK to measure
+  // with steady_clock instead.
+  #ifdef USE_STEADY_CLOCK
+    using Clock = std::chrono::steady_clock;
+  #else
+    using Clock = Utilities::TscClock;
+  #endif
 
   // Create a matrix indexed by Data Structure and Operation that holds a collection of time samples collected to perform the operation.
   using OperationName     = std::string;
@@ -43,24 +64,49 @@ namespace    // unnamed, anonymous namespace
   using SnapshotInterval  = std::size_t;
   using ElapsedTime       = Clock::duration;
 
+  // The samples collected within one interval:  their total, and their distribution so the tail isn't averaged away
+  struct Measurements
+  {
+    Measurements & operator+=( ElapsedTime sample )
+    {
+      total += sample;
+      latencies.record( sample );
+      return *this;
+    }
+
+    Measurements & operator+=( Measurements const & other )
+    {
+      total     += other.total;
+      latencies += other.latencies;
+      return *this;
+    }
+
+    ElapsedTime                 total = {};
+    Utilities::LatencyHistogram latencies;
+  };
+
   // A 3 dimensional collection of elapsed time measurements indexed by interval, data structure, and operation
-  using TimeMatrix = std::map<SnapshotInterval, std::map<DataStructureName, std::map<OperationName, ElapsedTime>>>;
+  using TimeMatrix = std::map<SnapshotInterval, std::map<DataStructureName, std::map<OperationName, Measurements>>>;
 
   struct Direction
   { enum value {Grow=1, Shrink=-Grow}; };
 
-  using Utilities::Timer;
+  using Timer = Utilities::TimerType<std::chrono::seconds, Clock>;                         // the progress timers tick on the preferred clock too
 
 
   template<typename Iter, typename T = typename Iter::value_type>
   struct SampleData : std::vector<T>
   {
     using std::vector<T>::vector;                                                                         // inherit constructors
-    SampleData( Iter begin, Iter end ) : std::vector<T>{ begin, end }
+    SampleData() = default;
+    SampleData( Iter begin, Iter end, std::uint64_t seed ) : std::vector<T>{ begin, end }
     {
       this->shrink_to_fit();
-      std::shuffle( this->begin(), this->end(), std::default_random_engine( std::random_device{}() ) );   // Guarantee they are not in any particular order
+      for( const auto & sample : *this ) for( unsigned char c : sample.isbn() ) digest = ( digest ^ c ) * 0x100'0000'01B3ULL;   // FNV-1a, in file order
+      std::shuffle( this->begin(), this->end(), std::default_random_engine( seed ) );                     // Guarantee they are not in any particular order
     }
+
+    std::uint64_t digest = 0xCBF2'9CE4'8422'2325ULL;                                                      // identifies the dataset, whatever order it's in
   };
 
 
@@ -69,6 +115,13 @@ namespace    // unnamed, anonymous namespace
   *********************************************************************************************************************************/
   std::ostream & operator<<( std::ostream & stream, const TimeMatrix & matrix );
 
+  std::vector<Benchmark::Cell> cells( const TimeMatrix & matrix );           // flattens the matrix for the report emitters
+  std::string                  clockDescription();
+  int                          compareResults( std::vector<std::string_view> const & args );   // the "compare" command
+
+  void save ( std::ostream & stream, const TimeMatrix & matrix );              // writes every measurement, for merge() to read back
+  void merge( std::istream & stream,       TimeMatrix & matrix );              // adds measurements written by save() into matrix
+
   template<class Operation>
   void measure( const std::string & structureName,                            // free text name of data structure being measured
                 const std::string & operationDescription,                     // free text name of the operation of the data structure being measured
@@ -88,9 +141,10 @@ namespace    // unnamed, anonymous namespace
   /*********************************************************************************************************************************
   **  Object Definitions
   *********************************************************************************************************************************/
-  TimeMatrix        runTimes;                                                 // collection of operation time measurements
-  const SampleData  sampleData{ std::istream_iterator<Book>( std::cin ),      // define and initialize from standard input a
-                                std::istream_iterator<Book>(          ) };    // collection of data samples
+  constexpr std::size_t SAMPLE_SIZE = 250;                                    // Number of operations to perform before reporting timing data
+
+  TimeMatrix                                 runTimes;                        // collection of operation time measurements
+  SampleData<std::istream_iterator<Book>>    sampleData;                      // collection of data samples, read from standard input by main()
 }    // unnamed, anonymous namespace
 
 
@@ -104,220 +158,289 @@ namespace    // unnamed, anonymous namespace
 
 /***********************************************************************************************************************************
 **  main() - Program entry point
+**
+**  Usage:  main [--parallel [workers] | --trace [file]] [--seed n] [--format csv|json] < "Open Library Database-Small.dat"
+**          main --sweep [maxElements] [--seed n] < "Open Library Database-Small.dat"
+**          main compare baseline.json candidate.json [--threshold percent]
+**
+**  By default every case runs, one after the other, in this process.  With --parallel, each case runs in its own process pinned
+**  to its own core, up to workers (default: every core available) at a time, and the results are merged into the same report.
+**  The samples are shuffled with a random seed unless one is given; either way it's recorded in the report's metadata.
+**
+**  --trace records each case and each measurement as an event in a Chrome trace file (default trace.json) for chrome://tracing or
+**  https://ui.perfetto.dev.  Forked workers can't add to this process's trace, so it can't be combined with --parallel.
+**
+**  --sweep replaces the usual cases with a cache-size sweep, timing each structure at sizes from 1,000 up to maxElements (default
+**  100 million) elements resampled from the database, and reports nanoseconds per element as CSV.
+**
+**  compare reads two JSON reports and exits with a failure status if the candidate is significantly slower anywhere, or is missing
+**  any structure/operation the baseline measured.  With --parallel, a case that fails to complete is left out of the report, recorded
+**  in its metadata, and also makes the exit status a failure.
 ***********************************************************************************************************************************/
-int main()
+int main( int argc, char * argv[] )
 {
-  Timer totalElapsedTime{ "Timer:  total elapsed time is ", std::clog };
-
-  /*********************************************************************************************************************************
-  **  Collect Vector Measurements
-  *********************************************************************************************************************************/
+  constexpr const char * USAGE = "Usage:  main [--parallel [workers] | --trace [file]] [--seed n] [--format csv|json] < database\n"
+                                 "        main --sweep [maxElements] [--seed n] < database\n"
+                                 "        main compare baseline.json candidate.json [--threshold percent]\n";
+
+  std::vector<std::string_view> args( argv + 1, argv + argc );
+  if( !args.empty()  &&  args[0] == "compare" )   return compareResults( args );
+
+  std::optional<std::size_t> workers;
+  std::optional<std::size_t> sweep;
+  std::uint64_t              seed   = std::random_device{}();
+  std::string_view           format = "csv";
+  std::optional<std::string> traceFile;
+  try
   {
-    std::clog << "\n\n\nStarting to collect Vector measurements\n";
-    Timer timer{ "Timer:  Vector measurements completed in ", std::clog };
-
-    {    // Insert at the back of a vector
-      std::vector<Book> v;
-      measure( "Vector", "Insert at the back", insert_at_back_of_vector{ v } );
-    }
-
-
-    {    // Insert at the front of a vector
-      std::vector<Book> v;
-      measure( "Vector", "Insert at the front", insert_at_front_of_vector{ v } );
-    }
-
-
-    {    // Remove from the back of a vector
-      std::vector<Book> v{ sampleData.cbegin(), sampleData.cend() };
-      measure( "Vector", "Remove from the back", remove_from_back_of_vector{ v }, Direction::Shrink );
-    }
-
-
-    {    // Remove from the front of a vector
-      std::vector<Book> v{ sampleData.cbegin(), sampleData.cend() };
-      measure( "Vector", "Remove from the front", remove_from_front_of_vector{ v }, Direction::Shrink );
-    }
-
-
-    {    // Search for an element in a vector
-      std::vector<Book> v;
-      v.reserve( sampleData.size() );
-      measure(
-          "Vector",
-          "Search",
-          [&]( const Book & book ) { v.push_back( book ); },
-          search_within_vector{ v, "non-existent" } );
+    for( std::size_t i = 0; i < args.size(); ++i )
+    {
+      bool hasValue = i + 1 < args.size()  &&  !args[i + 1].starts_with( "--" );
+
+      if     ( args[i] == "--parallel"            )   workers = hasValue ? std::stoul( std::string( args[++i] ) ) : std::max( std::thread::hardware_concurrency(), 1U );
+      else if( args[i] == "--sweep"               )   sweep   = hasValue ? std::stoull( std::string( args[++i] ) ) : 100'000'000;
+      else if( args[i] == "--trace"               )   traceFile = hasValue ? std::string( args[++i] ) : "trace.json";
+      else if( args[i] == "--seed"    && hasValue )   seed    = std::stoull( std::string( args[++i] ) );
+      else if( args[i] == "--format"  && hasValue  &&  ( args[i + 1] == "csv"  ||  args[i + 1] == "json" ) )   format = args[++i];
+      else throw std::invalid_argument( std::string( args[i] ) );
     }
-  }    // Collect Vector Measurements
-
-
-
-
-
-  /*********************************************************************************************************************************
-  **  Collect Doubly Linked List Measurements
-  *********************************************************************************************************************************/
+    if( sweep  &&  ( workers  ||  format != "csv" ) )   throw std::invalid_argument( "--sweep with --parallel or --format json" );
+    if( traceFile  &&  workers )                        throw std::invalid_argument( "--trace with --parallel" );
+  }
+  catch( const std::exception & ex )
   {
-    std::clog << "\nStarting to collect Doubly Linked List measurements\n";
-    Timer timer{ "Timer:  Doubly Linked List measurements completed in ", std::clog };
-
-    {    // Insert at the back of a doubly linked list
-      std::list<Book> dll;
-      measure( "DLL", "Insert at the back", insert_at_back_of_dll{ dll } );
-    }
+    std::cerr << "Unrecognized option " << ex.what() << '\n' << USAGE;
+    return EXIT_FAILURE;
+  }
 
+  Timer totalElapsedTime{ "Timer:  total elapsed time is ", std::clog };
+  sampleData = { std::istream_iterator<Book>( std::cin ), std::istream_iterator<Book>(), seed };
 
-    {    // Insert at the front of a doubly linked list
-      std::list<Book> dll;
-      measure( "DLL", "Insert at the front", insert_at_front_of_dll{ dll } );
-    }
+  auto metadata = Benchmark::describeHost();
+  metadata.emplace_back( "dataset books",  std::to_string( sampleData.size() ) );
+  metadata.emplace_back( "dataset digest", ( std::ostringstream{} << std::hex << sampleData.digest ).str() );
+  metadata.emplace_back( "seed",           std::to_string( seed ) );
 
+  if( sweep )
+  {
+    metadata.emplace_back( "mode", "cache sweep, up to " + std::to_string( *sweep ) + " elements" );
+    Benchmark::writeCsvMetadata( std::cout, metadata );
+    Benchmark::runCacheSweep( sampleData, *sweep, std::cout );
+    return EXIT_SUCCESS;
+  }
 
-    {    // Remove from the back of a doubly linked list
-      std::list<Book> dll{ sampleData.cbegin(), sampleData.cend() };
-      measure( "DLL", "Remove from the back", remove_from_back_of_dll{ dll }, Direction::Shrink );
-    }
 
+  std::vector<Benchmark::Case> cases =
+  {
+    /*******************************************************************************************************************************
+    **  Vector Measurements
+    *******************************************************************************************************************************/
+    { "Vector", "Insert at the back", []
+      {
+        std::vector<Book> v;
+        measure( "Vector", "Insert at the back", insert_at_back_of_vector{ v } );
+      } },
 
-    {    // Remove from the front of a doubly linked list
-      std::list<Book> dll{ sampleData.cbegin(), sampleData.cend() };
-      measure( "DLL", "Remove from the front", remove_from_front_of_dll{ dll }, Direction::Shrink );
-    }
+    { "Vector", "Insert at the front", []
+      {
+        std::vector<Book> v;
+        measure( "Vector", "Insert at the front", insert_at_front_of_vector{ v } );
+      } },
 
+    { "Vector", "Remove from the back", []
+      {
+        std::vector<Book> v{ sampleData.cbegin(), sampleData.cend() };
+        measure( "Vector", "Remove from the back", remove_from_back_of_vector{ v }, Direction::Shrink );
+      } },
 
-    {    // Search for an element in a doubly linked list
-      std::list<Book> dll;
-      measure(
-          "DLL",
-          "Search",
-          [&]( const Book & book ) { dll.push_back( book ); },
-          search_within_dll{ dll, "non-existent" } );
-    }
-  }    // Collect Doubly Linked List Measurements
+    { "Vector", "Remove from the front", []
+      {
+        std::vector<Book> v{ sampleData.cbegin(), sampleData.cend() };
+        measure( "Vector", "Remove from the front", remove_from_front_of_vector{ v }, Direction::Shrink );
+      } },
 
+    { "Vector", "Search", []
+      {
+        std::vector<Book> v;
+        v.reserve( sampleData.size() );
+        measure(
+            "Vector",
+            "Search",
+            [&]( const Book & book ) { v.push_back( book ); },
+            search_within_vector{ v, "non-existent" } );
+      } },
 
 
 
+    /*******************************************************************************************************************************
+    **  Doubly Linked List Measurements
+    *******************************************************************************************************************************/
+    { "Doubly Linked List", "Insert at the back", []
+      {
+        std::list<Book> dll;
+        measure( "DLL", "Insert at the back", insert_at_back_of_dll{ dll } );
+      } },
 
-  /*********************************************************************************************************************************
-  **  Collect Singly Linked List Measurements
-  *********************************************************************************************************************************/
-  {
-    std::clog << "\nStarting to collect Singly Linked List measurements\n";
-    Timer timer{ "Timer:  Singly Linked List measurements completed in ", std::clog };
+    { "Doubly Linked List", "Insert at the front", []
+      {
+        std::list<Book> dll;
+        measure( "DLL", "Insert at the front", insert_at_front_of_dll{ dll } );
+      } },
 
-    {    // Insert at the back of a singly linked list
-      std::forward_list<Book> sll;
-      measure( "SLL", "Insert at the back", insert_at_back_of_sll{ sll } );
-    }
+    { "Doubly Linked List", "Remove from the back", []
+      {
+        std::list<Book> dll{ sampleData.cbegin(), sampleData.cend() };
+        measure( "DLL", "Remove from the back", remove_from_back_of_dll{ dll }, Direction::Shrink );
+      } },
 
+    { "Doubly Linked List", "Remove from the front", []
+      {
+        std::list<Book> dll{ sampleData.cbegin(), sampleData.cend() };
+        measure( "DLL", "Remove from the front", remove_from_front_of_dll{ dll }, Direction::Shrink );
+      } },
 
-    {    // Insert at the front of a singly linked list
-      std::forward_list<Book> sll;
-      measure( "SLL", "Insert at the front", insert_at_front_of_sll{ sll } );
-    }
+    { "Doubly Linked List", "Search", []
+      {
+        std::list<Book> dll;
+        measure(
+            "DLL",
+            "Search",
+            [&]( const Book & book ) { dll.push_back( book ); },
+            search_within_dll{ dll, "non-existent" } );
+      } },
 
 
-    {    // Remove from the back of a singly linked list
-      std::forward_list<Book> ssl{ sampleData.cbegin(), sampleData.cend() };
-      measure( "SLL", "Remove from the back", remove_from_back_of_sll{ ssl }, Direction::Shrink );
-    }
 
+    /*******************************************************************************************************************************
+    **  Singly Linked List Measurements
+    *******************************************************************************************************************************/
+    { "Singly Linked List", "Insert at the back", []
+      {
+        std::forward_list<Book> sll;
+        measure( "SLL", "Insert at the back", insert_at_back_of_sll{ sll } );
+      } },
 
-    {    // Remove from the front of a singly linked list
-      std::forward_list<Book> sll{ sampleData.cbegin(), sampleData.cend() };
-      measure( "SLL", "Remove from the front", remove_from_front_of_sll{ sll }, Direction::Shrink );
-    }
+    { "Singly Linked List", "Insert at the front", []
+      {
+        std::forward_list<Book> sll;
+        measure( "SLL", "Insert at the front", insert_at_front_of_sll{ sll } );
+      } },
 
+    { "Singly Linked List", "Remove from the back", []
+      {
+        std::forward_list<Book> ssl{ sampleData.cbegin(), sampleData.cend() };
+        measure( "SLL", "Remove from the back", remove_from_back_of_sll{ ssl }, Direction::Shrink );
+      } },
 
-    {    // Search for an element in a singly linked list
-      std::forward_list<Book> sll;
-      measure(
-          "SLL",
-          "Search",
-          [&]( const Book & book ) { sll.push_front( book ); },
-          search_within_sll{ sll, "non-existent" } );
-    }
-  }    // Collect Singly Linked List Measurements
+    { "Singly Linked List", "Remove from the front", []
+      {
+        std::forward_list<Book> sll{ sampleData.cbegin(), sampleData.cend() };
+        measure( "SLL", "Remove from the front", remove_from_front_of_sll{ sll }, Direction::Shrink );
+      } },
 
+    { "Singly Linked List", "Search", []
+      {
+        std::forward_list<Book> sll;
+        measure(
+            "SLL",
+            "Search",
+            [&]( const Book & book ) { sll.push_front( book ); },
+            search_within_sll{ sll, "non-existent" } );
+      } },
 
 
 
+    /*******************************************************************************************************************************
+    **  Binary Search Tree Measurements
+    *******************************************************************************************************************************/
+    { "Binary Search Tree", "Insert", []
+      {
+        std::map<std::string, Book> map;
+        measure( "BST", "Insert", insert_into_bst{ map } );
+      } },
 
-  /*********************************************************************************************************************************
-  **  Collect Binary Search Tree Measurements
-  *********************************************************************************************************************************/
-  {
-    std::clog << "\nStarting to collect Binary Search Tree measurements\n";
-    Timer timer{ "Timer:  Binary Search Tree measurements completed in ", std::clog };
+    { "Binary Search Tree", "Remove", []
+      {
+        std::map<std::string, Book> map;
+        for( const auto & book : sampleData ) map.emplace( book.isbn(), book );
+        measure( "BST", "Remove", remove_from_bst{ map }, Direction::Shrink );
+      } },
 
-    {    // Insert into a binary search tree
-      std::map<std::string, Book> map;
-      measure( "BST", "Insert", insert_into_bst{ map } );
-    }
+    { "Binary Search Tree", "Search", []
+      {
+        std::map<std::string, Book> map;
+        measure(
+            "BST",
+            "Search",
+            [&]( const Book & book ) { map.emplace( book.isbn(), book ); },
+            search_within_bst{ map, "non-existent" } );
+      } },
 
 
-    {    // Remove from a binary search tree
-      std::map<std::string, Book> map;
-      for( const auto & book : sampleData ) map.emplace( book.isbn(), book );
-      measure( "BST", "Remove", remove_from_bst{ map }, Direction::Shrink );
-    }
 
+    /*******************************************************************************************************************************
+    **  Hash Table Measurements
+    *******************************************************************************************************************************/
+    { "Hash Table", "Insert", []
+      {
+        std::unordered_map<std::string, Book> u_map;
+        measure( "Hash Table", "Insert", insert_into_hash_table{ u_map } );
+      } },
 
-    {    // Search for an element in a binary search tree
-      std::map<std::string, Book> map;
-      measure(
-          "BST",
-          "Search",
-          [&]( const Book & book ) { map.emplace( book.isbn(), book ); },
-          search_within_bst{ map, "non-existent" } );
-    }
-  }    // Collect Binary Search Tree Measurements
+    { "Hash Table", "Remove", []
+      {
+        std::unordered_map<std::string, Book> u_map;
+        for( const auto & book : sampleData ) u_map.emplace( book.isbn(), book );
+        measure( "Hash Table", "Remove", remove_from_hash_table{ u_map }, Direction::Shrink );
+      } },
 
+    { "Hash Table", "Search", []
+      {
+        std::unordered_map<std::string, Book> u_map;
+        measure(
+            "Hash Table",
+            "Search",
+            [&]( const Book & book ) { u_map.emplace( book.isbn(), book ); },
+            search_within_hash_table{ u_map, "non-existent" } );
+      } }
+  };
 
 
 
+  //  Collect measurements
+  std::unique_ptr<Utilities::TraceSession> trace;
+  if( traceFile )   trace = std::make_unique<Utilities::TraceSession>( *traceFile );
 
-  /*********************************************************************************************************************************
-  **  Collect Hash Table Measurements
-  *********************************************************************************************************************************/
+  std::size_t failedCases = 0;
+  if( workers )
   {
-    std::clog << "\nStarting to collect Hash Table measurements\n";
-    Timer timer{ "Timer:  Hash Table measurements completed in ", std::clog };
-
-    {    // Insert into a hash table
-      std::unordered_map<std::string, Book> u_map;
-      measure( "Hash Table", "Insert", insert_into_hash_table{ u_map } );
-    }
-
-
-    {    // Remove from a hash table
-      std::unordered_map<std::string, Book> u_map;
-      for( const auto & book : sampleData ) u_map.emplace( book.isbn(), book );
-      measure( "Hash Table", "Remove", remove_from_hash_table{ u_map }, Direction::Shrink );
-    }
-
-
-    {    // Search for an element in a hash table
-      std::unordered_map<std::string, Book> u_map;
-      measure(
-          "Hash Table",
-          "Search",
-          [&]( const Book & book ) { u_map.emplace( book.isbn(), book ); },
-          search_within_hash_table{ u_map, "non-existent" } );
-    }
-  }    // Collect Hash Table Measurements
-
-
+    failedCases = Benchmark::runIsolated( cases, *workers,
+                                          [](                        ) noexcept { runTimes.clear();          },
+                                          []( std::ostream & results )          { save ( results, runTimes ); },
+                                          []( std::istream & results )          { merge( results, runTimes ); } );
+  }
+  else Benchmark::runInProcess( cases );
+  trace.reset();                                                              // completes the trace file
 
 
 
   //  Report measurements
-  std::cout << runTimes << '\n';
+  metadata.emplace_back( "sample size",    std::to_string( SAMPLE_SIZE ) );
+  metadata.emplace_back( "clock",          clockDescription() );
+  metadata.emplace_back( "mode",           workers ? "isolated, " + std::to_string( *workers ) + " workers" : "in process" );
+  if( failedCases > 0 )   metadata.emplace_back( "failed cases", std::to_string( failedCases ) );
+
+  if( format == "json" )   Benchmark::writeJson( std::cout, { metadata, cells( runTimes ) } );
+  else
+  {
+    Benchmark::writeCsvMetadata( std::cout, metadata );
+    std::cout << runTimes << '\n';
+  }
 
   std::clog << '\n'
             << std::string( 80, '-' ) << '\n';
+
+  return failedCases == 0 ? EXIT_SUCCESS : EXIT_FAILURE;                      // a report missing cases shouldn't pass for a whole one
 }  // main()
 
 
@@ -377,9 +500,10 @@ namespace    // unnamed, anonymous namespace
       Timer duration{ " in ", std::clog };
     } progress_raii{structureName, operationDescription};
 
+    // The whole measurement is one trace event, so the per-sample timing below isn't disturbed
+    Utilities::TraceTimer traced{ Utilities::TraceSession::label( structureName + "'s " + operationDescription ) };
 
 
-    constexpr std::size_t SAMPLE_SIZE = 250;                                  // Number of operations to perform before reporting timing data
 
     std::size_t sampleIndex = (direction == Direction::Grow) ? 0 : sampleData.size();
     for( const auto & element : sampleData )
@@ -423,28 +547,35 @@ namespace    // unnamed, anonymous namespace
 
   std::ostream & operator<<( std::ostream & stream, const TimeMatrix & matrix )
   {
+    // Percentiles reported for each operation after its total
+    constexpr std::pair<const char *, double> PERCENTILES[] = { {"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9} };
+
     if( !matrix.empty() )
     {
       // dump the data collected in a tab-separated values (tsv) table, for example:
-      //   Size  Vector/insert  Vector/Remove  List/insert  List/remove
-      //   10    1              1              23           14
-      //   20    3              2              40           37
+      //   Size  Vector/insert  Vector/insert p50  ...  Vector/insert max  List/insert  List/insert p50  ...
+      //   10    1              0                  ...  1                  23           2                ...
+      //   20    3              0                  ...  2                  40           4                ...
 
       // Display the table header
       stream << "Size";
-      for( const auto & [structure, operations] : matrix.begin()->second ) for( const auto & [operation, accumulatedTime] : operations )
+      for( const auto & [structure, operations] : matrix.begin()->second ) for( const auto & [operation, measurements] : operations )
       {
         stream << ',' << structure << '/' << operation;
+        for( const auto & [label, percent] : PERCENTILES ) stream << ',' << structure << '/' << operation << ' ' << label;
+        stream << ',' << structure << '/' << operation << " max";
       }
       stream << '\n';
 
-      // Display the table data
+      // Display the table data, all in nanoseconds
       for( const auto & [size, structures] : matrix )
       {
         stream << size;
-        for( const auto & [structure, operations] : structures )  for( const auto & [operation, accumulatedTime] : operations )
+        for( const auto & [structure, operations] : structures )  for( const auto & [operation, measurements] : operations )
         {
-          stream << ',' << std::chrono::duration_cast<std::chrono::nanoseconds>( accumulatedTime ).count();
+          stream << ',' << std::chrono::duration_cast<std::chrono::nanoseconds>( measurements.total ).count();
+          for( const auto & [label, percent] : PERCENTILES ) stream << ',' << measurements.latencies.percentile( percent );
+          stream << ',' << measurements.latencies.max();
         }
         stream << '\n';
       }
@@ -452,4 +583,95 @@ namespace    // unnamed, anonymous namespace
 
     return stream;
   }
+
+
+
+
+
+  std::vector<Benchmark::Cell> cells( const TimeMatrix & matrix )
+  {
+    std::vector<Benchmark::Cell> result;
+    for( const auto & [size, structures] : matrix )  for( const auto & [structure, operations] : structures )  for( const auto & [operation, measurements] : operations )
+    {
+      result.push_back( { size, structure, operation, std::chrono::duration_cast<std::chrono::nanoseconds>( measurements.total ).count(), measurements.latencies } );
+    }
+    return result;
+  }
+
+
+
+
+
+  std::string clockDescription()
+  {
+    #ifdef USE_STEADY_CLOCK
+      return "steady_clock";
+    #else
+      if( !Utilities::TscClock::invariant() )   return "steady_clock (no invariant TSC)";
+      return ( std::ostringstream{} << "TSC at " << Utilities::TscClock::ticksPerSecond() / 1e9 << " GHz" ).str();
+    #endif
+  }
+
+
+
+
+
+  int compareResults( std::vector<std::string_view> const & args )
+  {
+    double threshold = 5.0;
+    if( args.size() == 5  &&  args[3] == "--threshold" )   threshold = std::stod( std::string( args[4] ) );
+    else if( args.size() != 3 )
+    {
+      std::cerr << "Usage:  main compare baseline.json candidate.json [--threshold percent]\n";
+      return EXIT_FAILURE;
+    }
+
+    try
+    {
+      std::ifstream baselineFile { std::string( args[1] ) },
+                    candidateFile{ std::string( args[2] ) };
+      if( !baselineFile  ||  !candidateFile )   throw std::runtime_error( "Unable to open " + std::string( baselineFile ? args[2] : args[1] ) );
+
+      auto failures = Benchmark::compare( Benchmark::readJson( baselineFile ), Benchmark::readJson( candidateFile ), std::cout, threshold );
+      return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch( const std::exception & ex )
+    {
+      std::cerr << ex.what() << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+
+
+
+
+
+  // One line per cell:  interval, structure, and operation (tab separated since names contain spaces), then the total in nanoseconds
+  // and the latency histogram
+  void save( std::ostream & stream, const TimeMatrix & matrix )
+  {
+    for( const auto & [size, structures] : matrix )  for( const auto & [structure, operations] : structures )  for( const auto & [operation, measurements] : operations )
+    {
+      stream << size << '\t' << structure << '\t' << operation << '\t'
+             << std::chrono::duration_cast<std::chrono::nanoseconds>( measurements.total ).count() << ' ' << measurements.latencies << '\n';
+    }
+  }
+
+
+
+  void merge( std::istream & stream, TimeMatrix & matrix )
+  {
+    SnapshotInterval  size;
+    DataStructureName structure;
+    OperationName     operation;
+    long long         total;
+    Measurements      measurements;
+
+    while( stream >> size  &&  stream.ignore()  &&  std::getline( stream, structure, '\t' )  &&  std::getline( stream, operation, '\t' )
+           &&  stream >> total >> measurements.latencies )
+    {
+      measurements.total = std::chrono::duration_cast<ElapsedTime>( std::chrono::nanoseconds( total ) );
+      matrix[size][structure][operation] += measurements;
+    }
+  }
 }    // namespace